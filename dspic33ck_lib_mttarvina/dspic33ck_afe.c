@@ -0,0 +1,121 @@
+/*
+ * File:            dspic33ck_afe.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for op-amp analog front-end (AFE) routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_afe.h"
+
+
+// *****************************************************************************
+// AFE Routines
+//
+// - AMPCON1L AMPENx enables each op-amp, AMPON enables the module
+// - AMPCON1H NCHDISx trades input range for offset
+// - OAxOUT is also an ADC input, so the ADC reads the amplified signal directly
+//
+// *****************************************************************************
+
+static AFE_OBJ afe_obj[AFE_CHANNELS];
+
+
+void AFE_Attach( uint8_t _opamp, uint16_t _gain_x100, bool _low_offset ) {
+    AFE_OBJ *afe;
+    uint16_t bit;
+
+    if (_opamp < AFE_OA1 || _opamp > AFE_OA3 || _gain_x100 == 0) {
+        return;
+    }
+    afe = &afe_obj[_opamp - AFE_OA1];
+    bit = 1 << (_opamp - AFE_OA1);
+
+    switch (_opamp) {
+        case AFE_OA1:
+            afe->channel = AN0;
+            _TRISA1 = true;                                                     // OA1IN- and OA1IN+ as analog inputs
+            _ANSELA1 = true;
+            _TRISA2 = true;
+            _ANSELA2 = true;
+            break;
+        case AFE_OA2:
+            afe->channel = AN1;
+            _TRISB3 = true;                                                     // OA2IN- and OA2IN+ as analog inputs
+            _ANSELB3 = true;
+            _TRISB4 = true;
+            _ANSELB4 = true;
+            break;
+        case AFE_OA3:
+            afe->channel = AN4;
+            break;
+    }
+    afe->gain_x100 = _gain_x100;
+    afe->offset_uv = 0;
+    afe->units_per_volt = 1000000;                                              // default unit = uV
+
+    PMD_ModuleEnable(PMD_OPAMP);                                                // power up the op-amps before accessing their registers
+
+    if (_low_offset) {
+        AMPCON1H = AMPCON1H | bit;                                              // NCHDISx: N-channel input pair disabled
+    }
+    else {
+        AMPCON1H = AMPCON1H & ~bit;
+    }
+    AMPCON1L = AMPCON1L | bit;                                                  // AMPENx enabled;
+    AMPCON1Lbits.AMPON = true;
+
+    Analog_SetPin(afe->channel);                                                // OAxOUT pin as ADC input
+}
+
+
+void AFE_Detach( uint8_t _opamp ) {
+
+    if (_opamp < AFE_OA1 || _opamp > AFE_OA3) {
+        return;
+    }
+    AMPCON1L = AMPCON1L & ~(1 << (_opamp - AFE_OA1));
+    if ((AMPCON1L & 0x0007) == 0) {
+        AMPCON1Lbits.AMPON = false;
+        PMD_ModuleDisable(PMD_OPAMP);
+    }
+}
+
+
+void AFE_SetScale( uint8_t _opamp, int32_t _offset_uv, int32_t _units_per_volt ) {
+    afe_obj[_opamp - AFE_OA1].offset_uv = _offset_uv;
+    afe_obj[_opamp - AFE_OA1].units_per_volt = _units_per_volt;
+}
+
+
+uint8_t AFE_GetChannel( uint8_t _opamp ) {
+    return afe_obj[_opamp - AFE_OA1].channel;
+}
+
+
+uint32_t AFE_ToMicrovolts( uint8_t _opamp, uint16_t _result ) {
+    // uV = result * VREF / 4096 / (gain_x100 / 100)
+    return (uint32_t) (((uint64_t) _result * AFE_VREF_MV * 100000UL) / ((uint32_t) AFE_ADC_COUNTS * afe_obj[_opamp - AFE_OA1].gain_x100));
+}
+
+
+uint32_t AFE_ReadMicrovolts( uint8_t _opamp ) {
+    return AFE_ToMicrovolts(_opamp, ADC1_Read(afe_obj[_opamp - AFE_OA1].channel));
+}
+
+
+int32_t AFE_Read( uint8_t _opamp ) {
+    AFE_OBJ *afe;
+    int32_t input_uv;
+
+    afe = &afe_obj[_opamp - AFE_OA1];
+    input_uv = (int32_t) AFE_ReadMicrovolts(_opamp) - afe->offset_uv;
+
+    return (int32_t) (((int64_t) input_uv * afe->units_per_volt) / 1000000L);
+}
+
+
+/**
+ End of File
+*/
@@ -0,0 +1,139 @@
+/*
+ * File:            dspic33ck_afe.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for op-amp analog front-end (AFE) routines
+ */
+
+
+#ifndef _DSPIC33CK_AFE_H
+#define _DSPIC33CK_AFE_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define AFE_VREF_MV                   3300  // ADC reference = AVDD in mV
+#define AFE_ADC_COUNTS                4096  // 12bit
+
+#define AFE_OA1                       0x1   // OA1OUT = AN0 (RA0), IN- = RA1, IN+ = RA2
+#define AFE_OA2                       0x2   // OA2OUT = AN1 (RB2), IN- = RB3, IN+ = RB4
+#define AFE_OA3                       0x3   // OA3OUT = AN4 (RA4)
+#define AFE_CHANNELS                  3
+
+#define AFE_GAIN_FOLLOWER             100   // gain_x100 of a voltage follower, OAxOUT wired to OAxIN-
+
+
+typedef struct _AFE_OBJ_STRUCT {
+    uint8_t                 channel;                                            // ADC channel of OAxOUT
+    uint16_t                gain_x100;                                          // 1 + Rf/Rg, times 100
+    int32_t                 offset_uv;                                          // input voltage that reads as 0 units
+    int32_t                 units_per_volt;
+} AFE_OBJ;
+
+
+// *****************************************************************************
+// AFE Function Call Definitions
+// Op-amp gain is set by external resistors, the driver only needs its value
+// *****************************************************************************
+
+/**
+  @Description
+    Enables an op-amp and sets up its output as ADC input
+    Follower: OAxOUT wired to OAxIN-, _gain_x100 = AFE_GAIN_FOLLOWER
+    Non-inverting gain stage: Rf from OAxOUT to OAxIN-, Rg from OAxIN- to
+    ground, _gain_x100 = 100 * (1 + Rf/Rg)
+
+  @Param
+    _opamp = [AFE_OA1, AFE_OA2, AFE_OA3]
+    _gain_x100 = closed loop gain times 100
+    _low_offset = true disables the N-channel input pair, lower offset
+                  for signals near ground, input range no longer reaches AVDD
+
+  @Returns
+    None
+*/
+void AFE_Attach( uint8_t _opamp, uint16_t _gain_x100, bool _low_offset );
+
+/**
+  @Description
+    Disables an op-amp, the module is powered down with the last one
+
+  @Param
+    _opamp = [AFE_OA1, AFE_OA2, AFE_OA3]
+
+  @Returns
+    None
+*/
+void AFE_Detach( uint8_t _opamp );
+
+/**
+  @Description
+    Sets the conversion of the op-amp input voltage to engineering units
+    units = (input_uv - _offset_uv) * _units_per_volt / 1000000
+    e.g. 10mOhm shunt in mA: _offset_uv = 0, _units_per_volt = 100000
+
+  @Param
+    _opamp = [AFE_OA1, AFE_OA2, AFE_OA3]
+    _offset_uv = input voltage in uV that reads as 0
+    _units_per_volt = units per volt at the op-amp input
+
+  @Returns
+    None
+*/
+void AFE_SetScale( uint8_t _opamp, int32_t _offset_uv, int32_t _units_per_volt );
+
+/**
+  @Description
+    Returns the ADC channel wired to the op-amp output, for ADC1_Read()
+
+  @Param
+    _opamp = [AFE_OA1, AFE_OA2, AFE_OA3]
+
+  @Returns
+    [AN0, AN1, AN4]
+*/
+uint8_t AFE_GetChannel( uint8_t _opamp );
+
+/**
+  @Description
+    Converts an ADC result of the op-amp output to the voltage at the
+    op-amp input, gain removed
+
+  @Param
+    _opamp = [AFE_OA1, AFE_OA2, AFE_OA3]
+    _result = ADC1_Read() result of AFE_GetChannel(_opamp)
+
+  @Returns
+    input voltage in uV
+*/
+uint32_t AFE_ToMicrovolts( uint8_t _opamp, uint16_t _result );
+
+/**
+  @Description
+    Reads the op-amp output and returns the input voltage, gain removed
+
+  @Param
+    _opamp = [AFE_OA1, AFE_OA2, AFE_OA3]
+
+  @Returns
+    input voltage in uV
+*/
+uint32_t AFE_ReadMicrovolts( uint8_t _opamp );
+
+/**
+  @Description
+    Reads the op-amp output and returns it in engineering units
+    per AFE_SetScale()
+
+  @Param
+    _opamp = [AFE_OA1, AFE_OA2, AFE_OA3]
+
+  @Returns
+    value in engineering units
+*/
+int32_t AFE_Read( uint8_t _opamp );
+
+
+#endif //_DSPIC33CK_AFE_H
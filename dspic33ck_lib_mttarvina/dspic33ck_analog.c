@@ -22,12 +22,14 @@ static SCCP2_TMR_OBJ sccp2_obj;
 
 void SCCP2_Initialize(void) {
     
+    PMD_ModuleEnable(PMD_CCP2);                                                 // power up SCCP2 before accessing its registers
+    
     //    CCPI: CCP2 Capture/Compare Event
-    //    Priority: 1
-    IPC5bits.CCP2IP = 1;
+    //    Priority: SCCP2_IPL
+    IPC5bits.CCP2IP = SCCP2_IPL;
     //    CCTI: CCP2 Timer Event
-    //    Priority: 1
-    IPC6bits.CCT2IP = 1;
+    //    Priority: SCCP2_IPL
+    IPC6bits.CCT2IP = SCCP2_IPL;
         
     // CCPON disabled; MOD 16-Bit/32-Bit Timer;
     // CCSEL disabled; CCPSIDL disabled; T32 16 Bit;
@@ -64,6 +66,7 @@ void SCCP2_Initialize(void) {
     CCP2RB = 0x00;                                                              //CMP 0;
     CCP2BUFL = 0x00;                                                            //BUF 0;
     CCP2BUFH = 0x00;                                                            //BUF 0
+    sccp2_obj.synced = false;
          
     SCCP2_Start();
 }
@@ -105,9 +108,41 @@ void SCCP2_SetSamplingPeriod( uint16_t _period_us ) {
         sccp2_obj.pr = _period_us * 50;
     }    
 
+    PMD_ModuleEnable(PMD_CCP2);                                                 // power up SCCP2 before accessing its registers
+
     SCCP2_Stop();
+    CCP2CON1L = (0x00 & 0x7FFF);                                                //Disabling CCPON bit; MOD 16-Bit/32-Bit Timer, as SCCP2_Initialize() and undoes SCCP2_SyncToPWMA();
+    CCP2CON1H = 0x00;                                                           //SYNC None;
+    CCP2RA = 0x00;
+    CCP2TMRL = 0x00;
     CCP2PRL = sccp2_obj.pr - 1;
-    SCCP2_Start();
+    sccp2_obj.synced = false;
+    SCCP2_Start();                                                              // CCP2IE and CCT2IE back on
+}
+
+void SCCP2_SyncToPWMA( uint16_t _period, uint16_t _offset ) {
+
+    PMD_ModuleEnable(PMD_CCP2);                                                 // power up SCCP2 before accessing its registers
+
+    SCCP2_Stop();
+    CCP2CON1L = (0x01 & 0x7FFF);                                                //Disabling CCPON bit; MOD Single Edge Compare; CLKSEL FOSC/2 as SCCP3; TMRPS 1:1;
+    CCP2CON1H = 0x03;                                                           //SYNC SCCP3, the timer restarts with every PWMA period;
+    CCP2TMRL = 0x00;
+    CCP2PRL = _period;                                                          //same period as PWMA, the sync keeps the phase
+    CCP2RA = _offset;                                                           //compare event = ADC trigger
+    sccp2_obj.synced = true;
+
+    sccp2_obj.state = false;
+    IFS1bits.CCP2IF = false;
+    IFS1bits.CCT2IF = false;
+    IEC1bits.CCP2IE = false;                                                    // the compare event only goes to the ADC
+    IEC1bits.CCT2IE = true;                                                     // SCCP2_Triggered() once per PWMA period
+
+    CCP2CON1Lbits.CCPON = true;
+}
+
+bool SCCP2_IsSyncedToPWMA( void ) {
+    return sccp2_obj.synced;
 }
 
 bool SCCP2_Triggered( void ) {
@@ -120,9 +155,11 @@ bool SCCP2_Triggered( void ) {
     }
 }
 
-void __attribute__ ( ( interrupt, no_auto_psv ) ) _CCT2Interrupt ( void ) {
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CCT2Interrupt ( void ) {
+    CPULOAD_ISR_ENTER();
     sccp2_obj.state = true;
     IFS1bits.CCT2IF = false;
+    CPULOAD_ISR_EXIT(CPULOAD_SCCP2);
 }
 
 
@@ -139,13 +176,16 @@ static ADC1_OBJ adc1_obj;
 
 void ADC1_Initialize ( void ) {
 
+    PMD_ModuleEnable(PMD_ADC1);                                                 // power up ADC1 before accessing its registers
+    PMD_ModuleEnable(PMD_BIAS);                                                 // analog bias generator used by the ADC cores
+
     if (ADC1_USES_INTERRUPT) {
         //    ADCI: ADC Global Interrupt
-        //    Priority: 2
-        IPC22bits.ADCIP = 1;
+        //    Priority: ADC_IPL
+        IPC22bits.ADCIP = ADC_IPL;
         //    ADCAN0: ADC AN0 Convert Done
-        //    Priority: 2
-        IPC22bits.ADCAN0IP = 1;
+        //    Priority: ADC_IPL
+        IPC22bits.ADCAN0IP = ADC_IPL;
     }
 
     // ADSIDL disabled; ADON enabled; 
@@ -185,7 +225,7 @@ void ADC1_Initialize ( void ) {
     // C0CIE disabled; C1CIE disabled; SHRCIE disabled; WARMTIME 32768 Source Clock Periods; 
     ADCON5H = (0xF00 & 0xF0FF);                                                 //Disabling WARMTIME bit
 
-    ADCON5Hbits.WARMTIME = 0xF;                                                 // Setting WARMTIME bit
+    ADCON5Hbits.WARMTIME = ADC1_WARMTIME;                                       // Setting WARMTIME bit
     
     if (ADC1_IS_SOFTWARE_TRIGGERED) {
         //TRGSRC0 Common Software Trigger; TRGSRC1 Common Software Trigger; 
@@ -210,6 +250,9 @@ void ADC1_Initialize ( void ) {
 
 void ADC1_Core0PowerEnable( void ) {
     ADCON5Lbits.C0PWR = true; 
+    if (adc1_obj.deferPowerUp) {
+        return;                                                                 // Analog_FinishPin() waits and enables the core
+    }
     while(!ADCON5Lbits.C0RDY);
     ADCON3Hbits.C0EN = true;   
 }
@@ -223,6 +266,9 @@ void ADC1_Core0PowerDisable( void ) {
 
 void ADC1_Core1PowerEnable( void )  {
     ADCON5Lbits.C1PWR = true; 
+    if (adc1_obj.deferPowerUp) {
+        return;                                                                 // Analog_FinishPin() waits and enables the core
+    }
     while(!ADCON5Lbits.C1RDY);
     ADCON3Hbits.C1EN = true;     
 }
@@ -236,6 +282,9 @@ void ADC1_Core1PowerDisable( void )  {
 
 void ADC1_SharedCorePowerEnable( void ) {
     ADCON5Lbits.SHRPWR = true;   
+    if (adc1_obj.deferPowerUp) {
+        return;                                                                 // Analog_FinishPin() waits and enables the core
+    }
     while(!ADCON5Lbits.SHRRDY);
     ADCON3Hbits.SHREN = true;
 }
@@ -247,7 +296,7 @@ void ADC1_SharedCorePowerDisable( void ) {
 }
 
 
-uint16_t ADC1_GetConversionResult( uint8_t _channel ) {
+uint16_t ADC1_GetRawConversionResult( uint8_t _channel ) {
     switch(_channel) {
         case AN0:
             return ADCBUF0;
@@ -320,55 +369,69 @@ bool ADC1_IsConversionComplete( uint8_t _channel) {
 
 
 void ADC1_SetChannelInterrupt( uint8_t _channel, bool _state) {
+    //    ADCANx: ADC ANx Convert Done
+    //    Priority: ADC_IPL, same as ADCAN0
     switch(_channel) {
         case AN0:
             IFS5bits.ADCAN0IF = false;
+            _ADCAN0IP = ADC_IPL;
             IEC5bits.ADCAN0IE = _state;
             break;
         case AN1:
             IFS5bits.ADCAN1IF = false;
+            _ADCAN1IP = ADC_IPL;
             IEC5bits.ADCAN1IE = _state;
             break;         
         case AN2:
             IFS5bits.ADCAN2IF = false;
+            _ADCAN2IP = ADC_IPL;
             IEC5bits.ADCAN2IE = _state;
             break;
         case AN3:
             if (!DAC1CONLbits.DACOEN) {
                 IFS5bits.ADCAN3IF = false;
+                _ADCAN3IP = ADC_IPL;
                 IEC5bits.ADCAN3IE = _state;
             }
             break;
         case AN4:
             IFS5bits.ADCAN4IF = false;
+            _ADCAN4IP = ADC_IPL;
             IEC5bits.ADCAN4IE = _state;
             break;
         case AN5:
             IFS6bits.ADCAN5IF = false;
+            _ADCAN5IP = ADC_IPL;
             IEC6bits.ADCAN5IE = _state;
             break;
         case AN6:
             IFS6bits.ADCAN6IF = false;
+            _ADCAN6IP = ADC_IPL;
             IEC6bits.ADCAN6IE = _state;
             break;
         case AN7:
             IFS6bits.ADCAN7IF = false;
+            _ADCAN7IP = ADC_IPL;
             IEC6bits.ADCAN7IE = _state;
             break;
         case AN8:
             IFS6bits.ADCAN8IF = false;
+            _ADCAN8IP = ADC_IPL;
             IEC6bits.ADCAN8IE = _state;
             break;
         case AN9:
             IFS6bits.ADCAN9IF = false;
+            _ADCAN9IP = ADC_IPL;
             IEC6bits.ADCAN9IE = _state;
             break;
         case AN10:
             IFS6bits.ADCAN10IF = false;
+            _ADCAN10IP = ADC_IPL;
             IEC6bits.ADCAN10IE = _state;
             break;
         case AN11:
             IFS6bits.ADCAN11IF = false;
+            _ADCAN11IP = ADC_IPL;
             IEC6bits.ADCAN11IE = _state;
             break;
         default:
@@ -377,6 +440,52 @@ void ADC1_SetChannelInterrupt( uint8_t _channel, bool _state) {
 }
 
 
+void ADC1_SetTriggerSource( uint8_t _channel, uint8_t _source ) {
+    switch(_channel) {
+        case AN0:
+            ADTRIG0Lbits.TRGSRC0 = _source;
+            break;
+        case AN1:
+            ADTRIG0Lbits.TRGSRC1 = _source;
+            break;
+        case AN2:
+            ADTRIG0Hbits.TRGSRC2 = _source;
+            break;
+        case AN3:
+            if (!DAC1CONLbits.DACOEN) {
+                ADTRIG0Hbits.TRGSRC3 = _source;
+            }
+            break;
+        case AN4:
+            ADTRIG1Lbits.TRGSRC4 = _source;
+            break;
+        case AN5:
+            ADTRIG1Lbits.TRGSRC5 = _source;
+            break;
+        case AN6:
+            ADTRIG1Hbits.TRGSRC6 = _source;
+            break;
+        case AN7:
+            ADTRIG1Hbits.TRGSRC7 = _source;
+            break;
+        case AN8:
+            ADTRIG2Lbits.TRGSRC8 = _source;
+            break;
+        case AN9:
+            ADTRIG2Lbits.TRGSRC9 = _source;
+            break;
+        case AN10:
+            ADTRIG2Hbits.TRGSRC10 = _source;
+            break;
+        case AN11:
+            ADTRIG2Hbits.TRGSRC11 = _source;
+            break;
+        default:
+            break;
+    }
+}
+
+
 void Analog_SetPin( uint8_t _channel ) {
     switch (_channel) {
 
@@ -566,7 +675,30 @@ void Analog_SetPin( uint8_t _channel ) {
 }
 
 
-uint16_t ADC1_Read( uint8_t _channel ) {
+void Analog_BeginPin( uint8_t _channel ) {
+    adc1_obj.deferPowerUp = true;
+    Analog_SetPin(_channel);
+    adc1_obj.deferPowerUp = false;
+}
+
+
+void Analog_FinishPin( void ) {
+    if (ADCON5Lbits.C0PWR && !ADCON3Hbits.C0EN) {
+        while(!ADCON5Lbits.C0RDY);
+        ADCON3Hbits.C0EN = true;
+    }
+    if (ADCON5Lbits.C1PWR && !ADCON3Hbits.C1EN) {
+        while(!ADCON5Lbits.C1RDY);
+        ADCON3Hbits.C1EN = true;
+    }
+    if (ADCON5Lbits.SHRPWR && !ADCON3Hbits.SHREN) {
+        while(!ADCON5Lbits.SHRRDY);
+        ADCON3Hbits.SHREN = true;
+    }
+}
+
+
+uint16_t ADC1_ReadRaw( uint8_t _channel ) {
     // setup channel in shared core first before software triggering
 
     switch (_channel) {
@@ -648,73 +780,156 @@ uint16_t ADC1_Read( uint8_t _channel ) {
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN0Interrupt ( void ) {
+static uint16_t ADC1_Correct( uint8_t _channel, uint16_t _raw ) {
+    int16_t value;
+    uint8_t index;
+
+    if (!ADC1_USES_CALIBRATION || _channel < AN0 || _channel > AN11) {
+        return _raw;
+    }
+    index = _channel - AN0;
+    value = (int16_t) _raw - adc1_obj.offset[index];
+    value = value + (int16_t) (__builtin_mulss(value, adc1_obj.gain_error[index]) >> 15);   // (raw - offset) * (1 + gain_error)
+
+    if (value < 0) {
+        return 0;
+    }
+    if (value > 0x0FFF) {
+        return 0x0FFF;
+    }
+    return (uint16_t) value;
+}
+
+
+uint16_t ADC1_Read( uint8_t _channel ) {
+    return ADC1_Correct(_channel, ADC1_ReadRaw(_channel));
+}
+
+
+uint16_t ADC1_GetConversionResult( uint8_t _channel ) {
+    return ADC1_Correct(_channel, ADC1_GetRawConversionResult(_channel));
+}
+
+
+uint16_t ADC1_CalibrationMeasure( uint8_t _channel, uint8_t _samples ) {
+    uint32_t sum;
+    uint8_t i;
+
+    if (_samples == 0) {
+        return 0;
+    }
+    sum = 0;
+    for (i = 0; i < _samples; i++) {
+        sum += ADC1_ReadRaw(_channel);
+    }
+    return (uint16_t) ((sum + (_samples / 2)) / _samples);
+}
+
+
+bool ADC1_CalibrationCompute( uint8_t _channel, uint16_t _raw_low, uint16_t _ideal_low, uint16_t _raw_high, uint16_t _ideal_high ) {
+    int32_t raw_span;
+    int32_t ideal_span;
+    int32_t gain_error;
+
+    raw_span = (int32_t) _raw_high - _raw_low;
+    ideal_span = (int32_t) _ideal_high - _ideal_low;
+    if (raw_span <= 0 || ideal_span <= 0) {
+        return false;
+    }
+    gain_error = ((ideal_span - raw_span) * 32768L) / raw_span;                // ideal/raw - 1 in Q15
+    if (gain_error < -32768L || gain_error > 32767L) {
+        return false;
+    }
+    ADC1_SetCalibration(_channel, (int16_t) (_raw_low - ((int32_t) _ideal_low * raw_span) / ideal_span), (int16_t) gain_error);
+    return true;
+}
+
+
+void ADC1_SetCalibration( uint8_t _channel, int16_t _offset, int16_t _gain_error ) {
+    if (_channel < AN0 || _channel > AN11) {
+        return;
+    }
+    adc1_obj.offset[_channel - AN0] = _offset;
+    adc1_obj.gain_error[_channel - AN0] = _gain_error;
+}
+
+
+void ADC1_GetCalibration( uint8_t _channel, int16_t *_offset, int16_t *_gain_error ) {
+    if (_channel < AN0 || _channel > AN11) {
+        return;
+    }
+    *_offset = adc1_obj.offset[_channel - AN0];
+    *_gain_error = adc1_obj.gain_error[_channel - AN0];
+}
+
+
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN0Interrupt ( void ) {
     //clear the channel_AN0 interrupt flag
     IFS5bits.ADCAN0IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN1Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN1Interrupt ( void ) {
     //clear the channel_AN1 interrupt flag
     IFS5bits.ADCAN1IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN2Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN2Interrupt ( void ) {
     //clear the channel_AN2 interrupt flag
     IFS5bits.ADCAN2IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN3Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN3Interrupt ( void ) {
     //clear the channel_AN3 interrupt flag
     IFS5bits.ADCAN3IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN4Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN4Interrupt ( void ) {
     //clear the channel_AN4 interrupt flag
     IFS5bits.ADCAN4IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN5Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN5Interrupt ( void ) {
     //clear the channel_AN5 interrupt flag
     IFS6bits.ADCAN5IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN6Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN6Interrupt ( void ) {
     //clear the channel_AN6 interrupt flag
     IFS6bits.ADCAN6IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN7Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN7Interrupt ( void ) {
     //clear the channel_AN6 interrupt flag
     IFS6bits.ADCAN7IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN8Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN8Interrupt ( void ) {
     //clear the channel_AN8 interrupt flag
     IFS6bits.ADCAN8IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN9Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN9Interrupt ( void ) {
     //clear the channel_AN9 interrupt flag
     IFS6bits.ADCAN9IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN10Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN10Interrupt ( void ) {
     //clear the channel_AN10 interrupt flag
     IFS6bits.ADCAN10IF = false;
 }
 
 
-void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN11Interrupt ( void ) {
+void __attribute__ ( ( __interrupt__ , auto_psv, weak ISR_CONTEXT ) ) _ADCAN11Interrupt ( void ) {
     //clear the channel_AN11 interrupt flag
     IFS6bits.ADCAN11IF = false;
 }
@@ -723,13 +938,19 @@ void __attribute__ ( ( __interrupt__ , auto_psv, weak ) ) _ADCAN11Interrupt ( vo
 // *****************************************************************************
 // CMP1/DAC Routines
 //
-//
+// - the slope generator settings survive CMP1_Initialize() once
+//   DAC_SlopeConfigure() has been called
 //
 // *****************************************************************************
 
+static DAC_SLOPE_OBJ dac_slope_obj;
+
 
 void CMP1_Initialize( void ) {           
 
+    PMD_ModuleEnable(PMD_CMP1);                                                 // power up CMP1/DAC before accessing its registers
+    PMD_ModuleEnable(PMD_BIAS);                                                 // analog bias generator used by the comparator/DAC
+
     // Disable the CMP module before the initialization
     CMP1_Disable();
 	
@@ -741,11 +962,13 @@ void CMP1_Initialize( void ) {
 	DAC1CONL = 0x8200;                                                          //CMPPOL Non Inverted; HYSPOL Rising Edge; HYSSEL None; DACEN enabled; FLTREN disabled; CBE disabled; IRQM Interrupts are disabled; INSEL CMP1A; DACOEN enabled; 
 
 	//Slope Settings
-	SLP1CONH = 0x00;                                                            //HME disabled; PSE Negative; SLOPEN disabled; TWME disabled; 
-	SLP1CONL = 0x00;                                                            //HCFSEL None; SLPSTRT None; SLPSTOPB None; SLPSTOPA None; 
-	SLP1DAT = 0x00;                                                             //SLPDAT 0; 
-	DAC1DATL = 0x00;                                                            //DACDATL 0; 
-	DAC1DATH = 0x00;                                                            //DACDATH 0; 
+    if (!dac_slope_obj.configured) {
+        SLP1CONH = 0x00;                                                        //HME disabled; PSE Negative; SLOPEN disabled; TWME disabled; 
+        SLP1CONL = 0x00;                                                        //HCFSEL None; SLPSTRT None; SLPSTOPB None; SLPSTOPA None; 
+        SLP1DAT = 0x00;                                                         //SLPDAT 0; 
+        DAC1DATL = 0x00;                                                        //DACDATL 0; 
+        DAC1DATH = 0x00;                                                        //DACDATH 0; 
+    }
     
     CMP1_Enable();
 }
@@ -780,4 +1003,53 @@ void DAC_Enable( void ) {
     _TRISA3 = false;                                                            // set RA3 as output
     CMP1_Initialize();
     CMP1_EnableDACOutput();
+}
+
+
+void DAC_SlopeConfigure( uint8_t _mode, uint16_t _start, uint16_t _limit, uint16_t _rate ) {
+
+    PMD_ModuleEnable(PMD_CMP1);                                                 // may be called before CMP1_Initialize()
+    PMD_ModuleEnable(PMD_BIAS);
+
+    SLP1CONHbits.SLOPEN = 0;                                                    // no ramp while the limits change
+    switch (_mode) {
+        case DAC_SLOPE_NEGATIVE:
+            DAC1DATH = _start & 0x0FFF;                                         // ramp runs from DACDATH down to DACDATL
+            DAC1DATL = _limit & 0x0FFF;
+            SLP1CONH = 0x0000;                                                  //HME disabled; TWME disabled; PSE Negative; 
+            break;
+        case DAC_SLOPE_POSITIVE:
+            DAC1DATL = _start & 0x0FFF;                                         // ramp runs from DACDATL up to DACDATH
+            DAC1DATH = _limit & 0x0FFF;
+            SLP1CONH = 0x0200;                                                  //HME disabled; TWME disabled; PSE Positive; 
+            break;
+        case DAC_SLOPE_TRIANGLE:
+            DAC1DATL = ((_start < _limit) ? _start : _limit) & 0x0FFF;           // turns around at both DAC1DATL and DAC1DATH
+            DAC1DATH = ((_start < _limit) ? _limit : _start) & 0x0FFF;
+            SLP1CONH = (_start < _limit) ? 0x0E00 : 0x0C00;                     //HME enabled; TWME enabled; PSE in the direction of _limit; 
+            break;
+    }
+    SLP1DAT = _rate;
+    dac_slope_obj.configured = true;
+}
+
+
+void DAC_SlopeSetTriggers( uint8_t _start, uint8_t _stop_a, uint8_t _stop_b ) {
+    // HCFSEL kept; SLPSTOPA; SLPSTOPB; SLPSTRT;
+    SLP1CONL = (SLP1CONL & 0xF000) | ((uint16_t) (_stop_a & 0xF) << 8) | ((uint16_t) (_stop_b & 0xF) << 4) | (_start & 0xF);
+}
+
+
+void DAC_SlopeSetRate( uint16_t _rate ) {
+    SLP1DAT = _rate;
+}
+
+
+void DAC_SlopeEnable( void ) {
+    SLP1CONHbits.SLOPEN = 1;
+}
+
+
+void DAC_SlopeDisable( void ) {
+    SLP1CONHbits.SLOPEN = 0;
 }
\ No newline at end of file
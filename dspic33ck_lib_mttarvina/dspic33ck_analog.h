@@ -16,6 +16,26 @@
 
 #define ADC1_IS_SOFTWARE_TRIGGERED    true
 #define ADC1_USES_INTERRUPT           false
+#define ADC1_WARMTIME                 0xF   // core warm-up = 2^(WARMTIME+1) ADC source clock periods, 0xF = 32768
+#define ADC1_USES_CALIBRATION         true  // ADC1_Read() and ADC1_GetConversionResult() apply offset and gain correction
+#define ADC1_CHANNELS                 12
+
+#define ADC1_TRIGGER_NONE             0x00  // ADTRIGx TRGSRC values for ADC1_SetTriggerSource()
+#define ADC1_TRIGGER_SOFTWARE         0x01  // common software trigger, the ADC1_IS_SOFTWARE_TRIGGERED default
+#define ADC1_TRIGGER_PG1_TRIG1        0x04  // PWM generator 1 ADC trigger 1, PGx trigger 1 = 0x04 + 2 * (x - 1)
+#define ADC1_TRIGGER_SCCP2            0x15  // SCCP2 PWM/IC event, SCCPx = 0x14 + (x - 1)
+
+#define DAC_SLOPE_NEGATIVE            0x0   // ramps down from DAC1DATH to DAC1DATL
+#define DAC_SLOPE_POSITIVE            0x1   // ramps up from DAC1DATL to DAC1DATH
+#define DAC_SLOPE_TRIANGLE            0x2   // ramps up and down between DAC1DATL and DAC1DATH
+
+#define CMP1_INPUT_A                  0x0   // DAC1CONL INSEL, comparator 1 input CMP1A
+#define CMP1_INPUT_B                  0x1
+#define CMP1_INPUT_C                  0x2
+#define CMP1_INPUT_D                  0x3
+
+#define DAC_SLOPE_SRC_NONE            0x0   // SLPSTRT/SLPSTOPx source, no signal
+#define DAC_SLOPE_SRC_PG1             0x1   // PWM generator 1 trigger/output, up to PG8 = 0x8
 
 #define AN0                           0x1   // pin RA0 - analog channel dedicated to Core0
 #define AN1                           0x2   // pin RB2 - analog channel dedicated to Core1
@@ -34,15 +54,24 @@
 typedef struct _SCCP2_TMR_OBJ_STRUCT    {
     volatile bool           state;
     volatile uint16_t       pr;
+    volatile bool           synced;                                             // SCCP2 is the PWMA ADC trigger
 } SCCP2_TMR_OBJ;
 
 
 typedef struct _ADC1_OBJ_STRUCT    {
     volatile bool           ADC1Initialized;
     volatile uint8_t        counter;
+    volatile bool           deferPowerUp;
+    int16_t                 offset[ADC1_CHANNELS];                              // raw counts subtracted before gain
+    int16_t                 gain_error[ADC1_CHANNELS];                          // Q15, gain = 1 + gain_error, 0 = uncalibrated
 } ADC1_OBJ;
 
 
+typedef struct _DAC_SLOPE_OBJ_STRUCT    {
+    volatile bool           configured;                                         // CMP1_Initialize() leaves SLP1CONx, SLP1DAT and DAC1DATx alone
+} DAC_SLOPE_OBJ;
+
+
 // *****************************************************************************
 // SCCP2 Function Call Definitions
 // SCCP2 default timer period = 20us
@@ -103,6 +132,8 @@ inline static void SCCP2_InterruptPrioritySet( uint8_t _priorityValue ) {
 /**
   @Description
     Change the sampling rate or trigger rate of SCCP2
+    Also returns SCCP2 to the SCCP2_Initialize() timer mode, free running
+    and with CCP2IE/CCT2IE enabled, if SCCP2_SyncToPWMA() had taken it over
     Default = 50kHz
     
     Maximum PWM period range per Fosc:
@@ -120,6 +151,35 @@ inline static void SCCP2_InterruptPrioritySet( uint8_t _priorityValue ) {
 */
 void SCCP2_SetSamplingPeriod( uint16_t _period_us );
 
+/**
+  @Description
+    Phase locks SCCP2 to SCCP3/PWMA and turns it into the ADC trigger: the
+    SCCP2 compare event lands _offset counts after every PWMA period start
+    Used by PWMA_SetADCTrigger(). SCCP2_SetSamplingPeriod() undoes it and
+    puts SCCP2 back in free running timer mode with its interrupts enabled
+
+  @Param
+    _period = PWMA period count, CCP3PRL
+    _offset = trigger point count, [0 - _period]
+
+  @Returns
+    None
+*/
+void SCCP2_SyncToPWMA( uint16_t _period, uint16_t _offset );
+
+/**
+  @Description
+    Checks if SCCP2 is phase locked to PWMA by SCCP2_SyncToPWMA(), other
+    users of SCCP2 such as SPI1_StartTriggered() must leave it alone then
+
+  @Param
+    None.
+
+  @Returns
+    true if SCCP2 is the PWMA ADC trigger
+*/
+bool SCCP2_IsSyncedToPWMA( void );
+
 /**
   @Description
     Checks if SCCP2 is triggered
@@ -292,9 +352,37 @@ inline static void ADC1_SoftwareTriggerDisable( void ) {
 */
 void Analog_SetPin( uint8_t _channel );
 
+/**
+  @Description
+    Same as Analog_SetPin() but does not wait for the ADC core warm-up
+    The core keeps warming up in the background, call Analog_FinishPin()
+    before the first conversion
+
+  @Param
+    channel = ADC channel
+
+  @Returns
+    None
+*/
+void Analog_BeginPin( uint8_t _channel );
+
+/**
+  @Description
+    Waits for every powered ADC core to finish its warm-up and enables it
+    Completes the core power-up started by Analog_BeginPin()
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void Analog_FinishPin( void );
+
 /**
   @Description
     Read ADC value on specified channel
+    Offset and gain corrected if ADC1_USES_CALIBRATION is true
 
   @Param
     channel = ADC channel
@@ -304,9 +392,22 @@ void Analog_SetPin( uint8_t _channel );
 */
 uint16_t ADC1_Read( uint8_t _channel );
 
+/**
+  @Description
+    Read ADC value on specified channel, without calibration
+
+  @Param
+    channel = ADC channel
+
+  @Returns
+    raw ADC value
+*/
+uint16_t ADC1_ReadRaw( uint8_t _channel );
+
 /**
   @Description
     Gets ADC value from ADCBUFx register
+    Offset and gain corrected if ADC1_USES_CALIBRATION is true
 
   @Param
     channel = ADC channel
@@ -316,6 +417,77 @@ uint16_t ADC1_Read( uint8_t _channel );
 */
 uint16_t ADC1_GetConversionResult( uint8_t _channel );
 
+/**
+  @Description
+    Gets ADC value from ADCBUFx register, without calibration
+
+  @Param
+    channel = ADC channel
+
+  @Returns
+    raw ADCBUFx value
+*/
+uint16_t ADC1_GetRawConversionResult( uint8_t _channel );
+
+/**
+  @Description
+    Averages raw readings of a channel while a known reference is applied
+
+  @Param
+    channel = ADC channel
+    samples = number of readings to average
+
+  @Returns
+    average raw ADC value
+*/
+uint16_t ADC1_CalibrationMeasure( uint8_t _channel, uint8_t _samples );
+
+/**
+  @Description
+    Computes offset and gain of a channel from two reference points and
+    stores them. Readings are then corrected as
+    (raw - offset) * (1 + gain_error / 32768), one multiply per sample
+
+  @Param
+    channel = ADC channel
+    raw_low = ADC1_CalibrationMeasure() with the low reference applied
+    ideal_low = ideal ADC value of the low reference
+    raw_high = ADC1_CalibrationMeasure() with the high reference applied
+    ideal_high = ideal ADC value of the high reference
+
+  @Returns
+    false if the points are invalid or the gain is out of range
+*/
+bool ADC1_CalibrationCompute( uint8_t _channel, uint16_t _raw_low, uint16_t _ideal_low, uint16_t _raw_high, uint16_t _ideal_high );
+
+/**
+  @Description
+    Sets the calibration of a channel, e.g. restored from flash at startup
+
+  @Param
+    channel = ADC channel
+    offset = raw counts subtracted before gain
+    gain_error = Q15, gain = 1 + gain_error / 32768
+
+  @Returns
+    None
+*/
+void ADC1_SetCalibration( uint8_t _channel, int16_t _offset, int16_t _gain_error );
+
+/**
+  @Description
+    Gets the calibration of a channel, e.g. to be saved to flash
+
+  @Param
+    channel = ADC channel
+    offset = raw counts subtracted before gain
+    gain_error = Q15, gain = 1 + gain_error / 32768
+
+  @Returns
+    None
+*/
+void ADC1_GetCalibration( uint8_t _channel, int16_t *_offset, int16_t *_gain_error );
+
 /**
   @Description
     Returns true if ADC finished conversion 
@@ -328,6 +500,32 @@ uint16_t ADC1_GetConversionResult( uint8_t _channel );
 */
 bool ADC1_IsConversionComplete( uint8_t _channel);
 
+/**
+  @Description
+    Enables or disables the conversion done interrupt of a channel at ADC_IPL
+
+  @Param
+    channel = ADC channel
+    state = true to enable
+
+  @Returns
+    None
+*/
+void ADC1_SetChannelInterrupt( uint8_t _channel, bool _state );
+
+/**
+  @Description
+    Selects what starts the conversions of a channel, call with ADC1 disabled
+
+  @Param
+    channel = ADC channel
+    source = ADC1_TRIGGER_x
+
+  @Returns
+    None
+*/
+void ADC1_SetTriggerSource( uint8_t _channel, uint8_t _source );
+
 /**
   @Description
     Set ADC interrupt priority
@@ -433,5 +631,73 @@ void CMP1_DisableDACOutput( void );
 */
 void DAC_Enable( void );
 
+/**
+  @Description
+    Sets up the DAC1 slope generator. Once enabled the DAC ramps in
+    hardware at _rate per DAC clock, from _start towards _limit
+    For peak current mode the ramp restarts on every PWM cycle
+    The settings are kept by later CMP1_Initialize() and DAC_Enable() calls
+
+  @Param
+    _mode = [DAC_SLOPE_NEGATIVE, DAC_SLOPE_POSITIVE, DAC_SLOPE_TRIANGLE]
+    _start = DAC value where the ramp starts [0 - 4095]
+    _limit = DAC value where the ramp stops [0 - 4095]
+    _rate = SLP1DAT, DAC step per DAC clock
+
+  @Returns
+    None
+*/
+void DAC_SlopeConfigure( uint8_t _mode, uint16_t _start, uint16_t _limit, uint16_t _rate );
+
+/**
+  @Description
+    Selects the signals that start and stop the ramp
+
+  @Param
+    _start = SLPSTRT source, e.g. DAC_SLOPE_SRC_PG1
+    _stop_a = SLPSTOPA source
+    _stop_b = SLPSTOPB source
+
+  @Returns
+    None
+*/
+void DAC_SlopeSetTriggers( uint8_t _start, uint8_t _stop_a, uint8_t _stop_b );
+
+/**
+  @Description
+    Changes the slope rate while the ramp is running
+
+  @Param
+    _rate = SLP1DAT, DAC step per DAC clock
+
+  @Returns
+    None
+*/
+void DAC_SlopeSetRate( uint16_t _rate );
+
+/**
+  @Description
+    Enable the slope generator
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void DAC_SlopeEnable( void );
+
+/**
+  @Description
+    Disable the slope generator, DAC output holds DAC1DATH
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void DAC_SlopeDisable( void );
+
 #endif
 
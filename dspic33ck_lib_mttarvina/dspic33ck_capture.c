@@ -0,0 +1,347 @@
+/*
+ * File:            dspic33ck_capture.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for SCCP input capture routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_capture.h"
+
+
+// *****************************************************************************
+// Input Capture Routines
+//
+// - SCCP4 and SCCP5 run a free 32bit time base, each edge latches it into the capture FIFO
+// - CCPx interrupt drains the FIFO and turns timestamps into period and high time
+// - with CAPTURE_BOTH the edge polarity is tracked, and resynced from the pin after a FIFO overflow
+//
+// *****************************************************************************
+
+static CAPTURE_OBJ capture_obj[CAPTURE_CHANNELS];
+
+
+static void Capture_SetInterrupt( uint8_t _channel, bool _enable ) {
+    switch (_channel) {
+        case CAPTURE_SCCP4:
+            _CCP4IE = _enable;
+            break;
+        case CAPTURE_SCCP5:
+            _CCP5IE = _enable;
+            break;
+    }
+}
+
+
+static bool Capture_GetInterrupt( uint8_t _channel ) {
+    switch (_channel) {
+        case CAPTURE_SCCP4:
+            return _CCP4IE;
+        case CAPTURE_SCCP5:
+            return _CCP5IE;
+    }
+    return false;
+}
+
+
+static uint32_t Capture_ReadTimer( uint8_t _channel ) {
+    uint16_t high;
+    uint16_t low;
+
+    switch (_channel) {
+        case CAPTURE_SCCP4:
+            do {                                                                // re-read if the low word rolled over in between
+                high = CCP4TMRH;
+                low = CCP4TMRL;
+            } while (high != CCP4TMRH);
+            break;
+        case CAPTURE_SCCP5:
+            do {
+                high = CCP5TMRH;
+                low = CCP5TMRL;
+            } while (high != CCP5TMRH);
+            break;
+        default:
+            return 0;
+    }
+    return ((uint32_t) high << 16) | low;
+}
+
+
+static void Capture_Resync( CAPTURE_OBJ *_obj ) {
+    _obj->valid_rise = false;
+    _obj->next_rising = !(PORTB & _obj->pin_mask);                              // pin is high, next edge is falling
+}
+
+
+static void Capture_Store( CAPTURE_OBJ *_obj, uint32_t _timestamp ) {
+
+    if (_obj->edge != CAPTURE_BOTH) {
+        if (_obj->valid_rise) {
+            _obj->period = _timestamp - _obj->last_rise;
+            _obj->new_period = true;
+        }
+        _obj->last_rise = _timestamp;
+        _obj->valid_rise = true;
+        _obj->edge_count += _obj->edges_per_period;
+        return;
+    }
+
+    if (_obj->next_rising) {
+        if (_obj->valid_rise) {
+            _obj->period = _timestamp - _obj->last_rise;
+            _obj->new_period = true;
+        }
+        _obj->last_rise = _timestamp;
+        _obj->valid_rise = true;
+        _obj->edge_count++;
+    }
+    else if (_obj->valid_rise) {
+        _obj->high_time = _timestamp - _obj->last_rise;
+    }
+    _obj->next_rising = !_obj->next_rising;
+}
+
+
+void Capture_Attach( uint8_t _channel, uint8_t _pin, uint8_t _edge, uint8_t _prescale ) {
+    CAPTURE_OBJ *obj;
+    uint16_t con1l;
+
+    if (_channel >= CAPTURE_CHANNELS) {
+        return;
+    }
+    obj = &capture_obj[_channel];
+    obj->pin_mask = PWMx_GetPinRegister(_pin);
+    obj->edge = _edge;
+    obj->tick_cycles = 1 << (2 * _prescale);                                    // 1, 4, 16, 64
+    obj->period = 0;
+    obj->high_time = 0;
+    obj->edge_count = 0;
+    obj->overflows = 0;
+    obj->new_period = false;
+
+    switch (_edge) {
+        case CAPTURE_RISING_4:
+            obj->edges_per_period = 4;
+            break;
+        case CAPTURE_RISING_16:
+            obj->edges_per_period = 16;
+            break;
+        default:
+            obj->edges_per_period = 1;
+            break;
+    }
+
+    // CCPON disabled; CLKSEL FOSC/2; TMRPS per _prescale; T32 32 Bit; CCSEL Input Capture; MOD per _edge;
+    con1l = 0x0030 | ((_prescale & 0x3) << 6) | (_edge & 0xF);
+
+    switch (_channel) {
+        case CAPTURE_SCCP4:
+            PMD_ModuleEnable(PMD_CCP4);                                         // power up SCCP4 before accessing its registers
+            _ICM4R = PPS_SetInputPin(_pin);
+
+            CCP4CON1L = con1l;
+            CCP4CON1H = 0x00;                                                   // OPS interrupt on every capture event;
+            CCP4CON2L = 0x00;
+            CCP4CON2H = 0x00;                                                   // ICSEL ICM4 pin via PPS;
+            CCP4CON3H = 0x00;
+            CCP4STATL = 0x00;                                                   // ICOV cleared;
+            CCP4TMRL = 0x00;
+            CCP4TMRH = 0x00;
+            CCP4PRL = 0xFFFF;                                                   // PR 0xFFFFFFFF, free-running;
+            CCP4PRH = 0xFFFF;
+
+            //    CCP4I: CCP4 Capture Event
+            //    Priority: CAPTURE_IPL
+            _CCP4IP = CAPTURE_IPL;
+            _CCT4IE = false;
+            _CCP4IF = false;
+            break;
+
+        case CAPTURE_SCCP5:
+            PMD_ModuleEnable(PMD_CCP5);                                         // power up SCCP5 before accessing its registers
+            _ICM5R = PPS_SetInputPin(_pin);
+
+            CCP5CON1L = con1l;
+            CCP5CON1H = 0x00;                                                   // OPS interrupt on every capture event;
+            CCP5CON2L = 0x00;
+            CCP5CON2H = 0x00;                                                   // ICSEL ICM5 pin via PPS;
+            CCP5CON3H = 0x00;
+            CCP5STATL = 0x00;                                                   // ICOV cleared;
+            CCP5TMRL = 0x00;
+            CCP5TMRH = 0x00;
+            CCP5PRL = 0xFFFF;                                                   // PR 0xFFFFFFFF, free-running;
+            CCP5PRH = 0xFFFF;
+
+            //    CCP5I: CCP5 Capture Event
+            //    Priority: CAPTURE_IPL
+            _CCP5IP = CAPTURE_IPL;
+            _CCT5IE = false;
+            _CCP5IF = false;
+            break;
+    }
+}
+
+
+void Capture_Start( uint8_t _channel ) {
+    Capture_Resync(&capture_obj[_channel]);
+    switch (_channel) {
+        case CAPTURE_SCCP4:
+            _CCP4IE = true;
+            CCP4CON1Lbits.CCPON = true;
+            break;
+        case CAPTURE_SCCP5:
+            _CCP5IE = true;
+            CCP5CON1Lbits.CCPON = true;
+            break;
+    }
+}
+
+
+void Capture_Stop( uint8_t _channel ) {
+    switch (_channel) {
+        case CAPTURE_SCCP4:
+            CCP4CON1Lbits.CCPON = false;
+            _CCP4IE = false;
+            break;
+        case CAPTURE_SCCP5:
+            CCP5CON1Lbits.CCPON = false;
+            _CCP5IE = false;
+            break;
+    }
+}
+
+
+bool Capture_Triggered( uint8_t _channel ) {
+    if (capture_obj[_channel].new_period) {
+        capture_obj[_channel].new_period = false;
+        return true;
+    }
+    return false;
+}
+
+
+uint32_t Capture_GetPeriod( uint8_t _channel ) {
+    uint32_t period;
+    bool enabled;
+
+    enabled = Capture_GetInterrupt(_channel);
+    Capture_SetInterrupt(_channel, false);                                      // 32bit value is written by the interrupt
+    period = capture_obj[_channel].period;
+    Capture_SetInterrupt(_channel, enabled);                                    // stays off after Capture_Stop()
+
+    return (uint32_t) (((uint64_t) period * capture_obj[_channel].tick_cycles) / capture_obj[_channel].edges_per_period);
+}
+
+
+uint32_t Capture_GetFrequency( uint8_t _channel ) {
+    CAPTURE_OBJ *obj;
+    uint32_t period;
+    uint32_t last_rise;
+    uint32_t elapsed;
+    bool enabled;
+
+    obj = &capture_obj[_channel];
+    enabled = Capture_GetInterrupt(_channel);
+    Capture_SetInterrupt(_channel, false);
+    period = obj->period;
+    last_rise = obj->last_rise;
+    Capture_SetInterrupt(_channel, enabled);
+
+    if (period == 0) {
+        return 0;
+    }
+    elapsed = Capture_ReadTimer(_channel) - last_rise;
+    if (elapsed / CAPTURE_STALE_PERIODS > period) {                             // signal stopped
+        return 0;
+    }
+    return (uint32_t) (((uint64_t) CLOCK_InstructionFrequencyGet() * 1000UL * obj->edges_per_period) / ((uint64_t) period * obj->tick_cycles));
+}
+
+
+uint16_t Capture_GetDuty( uint8_t _channel ) {
+    uint32_t period;
+    uint32_t high_time;
+    bool enabled;
+
+    enabled = Capture_GetInterrupt(_channel);
+    Capture_SetInterrupt(_channel, false);
+    period = capture_obj[_channel].period;
+    high_time = capture_obj[_channel].high_time;
+    Capture_SetInterrupt(_channel, enabled);
+
+    if (period == 0 || capture_obj[_channel].edge != CAPTURE_BOTH) {
+        return 0;
+    }
+    if (high_time >= period) {
+        return 4096;
+    }
+    return (uint16_t) (((uint64_t) high_time << 12) / period);
+}
+
+
+uint32_t Capture_GetEdgeCount( uint8_t _channel ) {
+    uint32_t count;
+    bool enabled;
+
+    enabled = Capture_GetInterrupt(_channel);
+    Capture_SetInterrupt(_channel, false);
+    count = capture_obj[_channel].edge_count;
+    Capture_SetInterrupt(_channel, enabled);
+
+    return count;
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CCP4Interrupt ( void ) {
+    uint16_t low;
+
+    CPULOAD_ISR_ENTER();
+    _CCP4IF = false;
+    if (CCP4STATLbits.ICOV) {                                                   // edges were lost, polarity unknown
+        while (CCP4STATLbits.ICBNE) {
+            low = CCP4BUFL;
+            low = CCP4BUFH;
+        }
+        CCP4STATLbits.ICOV = false;
+        capture_obj[CAPTURE_SCCP4].overflows++;
+        Capture_Resync(&capture_obj[CAPTURE_SCCP4]);
+        CPULOAD_ISR_EXIT(CPULOAD_CAPTURE);
+        return;
+    }
+    while (CCP4STATLbits.ICBNE) {
+        low = CCP4BUFL;                                                         // reading the high word pops the FIFO
+        Capture_Store(&capture_obj[CAPTURE_SCCP4], ((uint32_t) CCP4BUFH << 16) | low);
+    }
+    CPULOAD_ISR_EXIT(CPULOAD_CAPTURE);
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CCP5Interrupt ( void ) {
+    uint16_t low;
+
+    CPULOAD_ISR_ENTER();
+    _CCP5IF = false;
+    if (CCP5STATLbits.ICOV) {                                                   // edges were lost, polarity unknown
+        while (CCP5STATLbits.ICBNE) {
+            low = CCP5BUFL;
+            low = CCP5BUFH;
+        }
+        CCP5STATLbits.ICOV = false;
+        capture_obj[CAPTURE_SCCP5].overflows++;
+        Capture_Resync(&capture_obj[CAPTURE_SCCP5]);
+        CPULOAD_ISR_EXIT(CPULOAD_CAPTURE);
+        return;
+    }
+    while (CCP5STATLbits.ICBNE) {
+        low = CCP5BUFL;                                                         // reading the high word pops the FIFO
+        Capture_Store(&capture_obj[CAPTURE_SCCP5], ((uint32_t) CCP5BUFH << 16) | low);
+    }
+    CPULOAD_ISR_EXIT(CPULOAD_CAPTURE);
+}
+
+
+/**
+ End of File
+*/
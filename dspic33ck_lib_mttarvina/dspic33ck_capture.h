@@ -0,0 +1,160 @@
+/*
+ * File:            dspic33ck_capture.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for SCCP input capture routines
+ */
+
+
+#ifndef _DSPIC33CK_CAPTURE_H
+#define _DSPIC33CK_CAPTURE_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define CAPTURE_SCCP4                 0x0   // capture channel on SCCP4, input ICM4
+#define CAPTURE_SCCP5                 0x1   // capture channel on SCCP5, input ICM5
+#define CAPTURE_CHANNELS              2
+
+#define CAPTURE_RISING                0x1   // MOD bits, capture every rising edge
+#define CAPTURE_FALLING               0x2   // capture every falling edge
+#define CAPTURE_BOTH                  0x3   // capture every edge, needed for duty cycle
+#define CAPTURE_RISING_4              0x4   // capture every 4th rising edge
+#define CAPTURE_RISING_16             0x5   // capture every 16th rising edge
+
+#define CAPTURE_TMRPS_1               0x0   // TMRPS bits, timestamp resolution = 1 instruction cycle
+#define CAPTURE_TMRPS_4               0x1
+#define CAPTURE_TMRPS_16              0x2
+#define CAPTURE_TMRPS_64              0x3
+
+#define CAPTURE_STALE_PERIODS         4     // no edge within this many periods reads as 0Hz
+
+
+typedef struct _CAPTURE_OBJ_STRUCT {
+    uint16_t                pin_mask;                                           // PORTB bit, read to resync edge polarity
+    uint8_t                 edge;
+    uint8_t                 edges_per_period;                                   // input periods between two timestamps
+    uint8_t                 tick_cycles;                                        // instruction cycles per timestamp tick
+    volatile bool           next_rising;                                        // CAPTURE_BOTH only
+    volatile bool           valid_rise;
+    volatile bool           new_period;
+    volatile uint32_t       last_rise;                                          // last rising (or selected) edge timestamp
+    volatile uint32_t       period;                                             // in timestamp ticks
+    volatile uint32_t       high_time;                                          // in timestamp ticks, CAPTURE_BOTH only
+    volatile uint32_t       edge_count;
+    volatile uint16_t       overflows;
+} CAPTURE_OBJ;
+
+
+// *****************************************************************************
+// Input Capture Function Call Definitions
+// 32bit timestamps, timer clock = FOSC/2 / prescaler
+// *****************************************************************************
+
+/**
+  @Description
+    Initializes an SCCP module in 32bit input capture mode
+    Maps the input through PPS, every capture is read from the FIFO in the
+    CCPx interrupt
+
+  @Param
+    _channel = [CAPTURE_SCCP4, CAPTURE_SCCP5]
+    _pin = input pin [PB0-PB15]
+    _edge = [CAPTURE_RISING, CAPTURE_FALLING, CAPTURE_BOTH, CAPTURE_RISING_4, CAPTURE_RISING_16]
+    _prescale = [CAPTURE_TMRPS_1, CAPTURE_TMRPS_4, CAPTURE_TMRPS_16, CAPTURE_TMRPS_64]
+
+  @Returns
+    None
+*/
+void Capture_Attach( uint8_t _channel, uint8_t _pin, uint8_t _edge, uint8_t _prescale );
+
+/**
+  @Description
+    Start capturing
+
+  @Param
+    _channel = [CAPTURE_SCCP4, CAPTURE_SCCP5]
+
+  @Returns
+    None
+*/
+void Capture_Start( uint8_t _channel );
+
+/**
+  @Description
+    Stop capturing
+
+  @Param
+    _channel = [CAPTURE_SCCP4, CAPTURE_SCCP5]
+
+  @Returns
+    None
+*/
+void Capture_Stop( uint8_t _channel );
+
+/**
+  @Description
+    Checks if a new period was measured since the last call
+
+  @Param
+    _channel = [CAPTURE_SCCP4, CAPTURE_SCCP5]
+
+  @Returns
+    true if a new period is available
+*/
+bool Capture_Triggered( uint8_t _channel );
+
+/**
+  @Description
+    Returns the last measured period of the input signal
+
+  @Param
+    _channel = [CAPTURE_SCCP4, CAPTURE_SCCP5]
+
+  @Returns
+    period in instruction cycles, 0 if no period was measured yet
+*/
+uint32_t Capture_GetPeriod( uint8_t _channel );
+
+/**
+  @Description
+    Returns the frequency of the input signal
+    Reads 0 if no edge came within CAPTURE_STALE_PERIODS periods
+
+  @Param
+    _channel = [CAPTURE_SCCP4, CAPTURE_SCCP5]
+
+  @Returns
+    frequency in mHz
+*/
+uint32_t Capture_GetFrequency( uint8_t _channel );
+
+/**
+  @Description
+    Returns the duty cycle of the input signal, needs CAPTURE_BOTH
+
+  @Param
+    _channel = [CAPTURE_SCCP4, CAPTURE_SCCP5]
+
+  @Returns
+    [0 - 4096] which translates to 0 - 100% duty cycle
+*/
+uint16_t Capture_GetDuty( uint8_t _channel );
+
+/**
+  @Description
+    Returns the number of captured edges since Capture_Attach()
+    For pulse counting, e.g. flow meters
+
+  @Param
+    _channel = [CAPTURE_SCCP4, CAPTURE_SCCP5]
+
+  @Returns
+    edge count
+*/
+uint32_t Capture_GetEdgeCount( uint8_t _channel );
+
+
+#endif //_DSPIC33CK_CAPTURE_H
@@ -0,0 +1,166 @@
+/*
+ * File:            dspic33ck_clc.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for Configurable Logic Cell (CLC) routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_clc.h"
+
+
+// *****************************************************************************
+// CLC Routines
+//
+// - CLCxSEL picks 4 data sources, CLCxGLSL/H route them into 4 gates,
+//   CLCxCONL MODE combines the gates into the output
+//
+// *****************************************************************************
+
+void CLC_Initialize( uint8_t _clc, const CLC_CONFIG *_config ) {
+    uint16_t conl;
+    uint16_t conh;
+    uint16_t sel;
+    uint16_t glsl;
+    uint16_t glsh;
+
+    // LCEN disabled; INTP disabled; INTN disabled; LCOE disabled; LCPOL per output_invert; MODE per mode;
+    conl = (_config->mode & 0x7) | (_config->output_invert ? 0x0020 : 0x0000);
+    conh = _config->gate_invert & 0x0F;                                         // G4POL-G1POL
+    sel = ((uint16_t) (_config->source[3] & 0x7) << 12) | ((uint16_t) (_config->source[2] & 0x7) << 8)
+        | ((uint16_t) (_config->source[1] & 0x7) << 4) | (_config->source[0] & 0x7);
+    glsl = ((uint16_t) _config->gate[1] << 8) | _config->gate[0];              // G2Dx | G1Dx
+    glsh = ((uint16_t) _config->gate[3] << 8) | _config->gate[2];              // G4Dx | G3Dx
+
+    switch (_clc) {
+        case CLC1:
+            PMD_ModuleEnable(PMD_CLC1);                                         // power up CLC1 before accessing its registers
+            CLC1CONL = conl;
+            CLC1CONH = conh;
+            CLC1SEL = sel;
+            CLC1GLSL = glsl;
+            CLC1GLSH = glsh;
+            break;
+        case CLC2:
+            PMD_ModuleEnable(PMD_CLC2);                                         // power up CLC2 before accessing its registers
+            CLC2CONL = conl;
+            CLC2CONH = conh;
+            CLC2SEL = sel;
+            CLC2GLSL = glsl;
+            CLC2GLSH = glsh;
+            break;
+        case CLC3:
+            PMD_ModuleEnable(PMD_CLC3);                                         // power up CLC3 before accessing its registers
+            CLC3CONL = conl;
+            CLC3CONH = conh;
+            CLC3SEL = sel;
+            CLC3GLSL = glsl;
+            CLC3GLSH = glsh;
+            break;
+        case CLC4:
+            PMD_ModuleEnable(PMD_CLC4);                                         // power up CLC4 before accessing its registers
+            CLC4CONL = conl;
+            CLC4CONH = conh;
+            CLC4SEL = sel;
+            CLC4GLSL = glsl;
+            CLC4GLSH = glsh;
+            break;
+    }
+}
+
+
+void CLC_Enable( uint8_t _clc ) {
+    switch (_clc) {
+        case CLC1:
+            CLC1CONLbits.LCEN = true;
+            break;
+        case CLC2:
+            CLC2CONLbits.LCEN = true;
+            break;
+        case CLC3:
+            CLC3CONLbits.LCEN = true;
+            break;
+        case CLC4:
+            CLC4CONLbits.LCEN = true;
+            break;
+    }
+}
+
+
+void CLC_Disable( uint8_t _clc ) {
+    switch (_clc) {
+        case CLC1:
+            CLC1CONLbits.LCEN = false;
+            break;
+        case CLC2:
+            CLC2CONLbits.LCEN = false;
+            break;
+        case CLC3:
+            CLC3CONLbits.LCEN = false;
+            break;
+        case CLC4:
+            CLC4CONLbits.LCEN = false;
+            break;
+    }
+}
+
+
+bool CLC_GetOutput( uint8_t _clc ) {
+    switch (_clc) {
+        case CLC1:
+            return CLC1CONLbits.LCOUT;
+        case CLC2:
+            return CLC2CONLbits.LCOUT;
+        case CLC3:
+            return CLC3CONLbits.LCOUT;
+        case CLC4:
+            return CLC4CONLbits.LCOUT;
+    }
+    return false;
+}
+
+
+void CLC_SetInputPin( uint8_t _input, uint8_t _pin ) {
+    switch (_input) {
+        case CLC_IN_A:
+            _CLCINAR = PPS_SetInputPin(_pin);
+            break;
+        case CLC_IN_B:
+            _CLCINBR = PPS_SetInputPin(_pin);
+            break;
+        case CLC_IN_C:
+            _CLCINCR = PPS_SetInputPin(_pin);
+            break;
+        case CLC_IN_D:
+            _CLCINDR = PPS_SetInputPin(_pin);
+            break;
+    }
+}
+
+
+void CLC_SetOutputPin( uint8_t _clc, uint8_t _pin ) {
+    switch (_clc) {
+        case CLC1:
+            PPS_SetOutputPin(_pin, PPS_OUT_CLC1);
+            CLC1CONLbits.LCOE = true;
+            break;
+        case CLC2:
+            PPS_SetOutputPin(_pin, PPS_OUT_CLC2);
+            CLC2CONLbits.LCOE = true;
+            break;
+        case CLC3:
+            PPS_SetOutputPin(_pin, PPS_OUT_CLC3);
+            CLC3CONLbits.LCOE = true;
+            break;
+        case CLC4:
+            PPS_SetOutputPin(_pin, PPS_OUT_CLC4);
+            CLC4CONLbits.LCOE = true;
+            break;
+    }
+}
+
+
+/**
+ End of File
+*/
@@ -0,0 +1,178 @@
+/*
+ * File:            dspic33ck_clc.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for Configurable Logic Cell (CLC) routines
+ */
+
+
+#ifndef _DSPIC33CK_CLC_H
+#define _DSPIC33CK_CLC_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define CLC1                          0x1
+#define CLC2                          0x2
+#define CLC3                          0x3
+#define CLC4                          0x4
+
+#define CLC_MODE_AND_OR               0x0   // (G1 & G2) | (G3 & G4)
+#define CLC_MODE_OR_XOR               0x1   // (G1 | G2) ^ (G3 | G4)
+#define CLC_MODE_AND4                 0x2   // G1 & G2 & G3 & G4
+#define CLC_MODE_SR_LATCH             0x3   // S = G1 | G2, R = G3 | G4
+#define CLC_MODE_D_FF_SR              0x4   // CLK = G1, D = G2, S = G4, R = G3
+#define CLC_MODE_D_FF_R               0x5   // CLK = G1, D = G2 & G4, R = G3
+#define CLC_MODE_JK_FF_R              0x6   // CLK = G1, J = G2, K = G4, R = G3
+#define CLC_MODE_LATCH_SR             0x7   // transparent latch, LE = G1, D = G2, S = G4, R = G3
+
+#define CLC_DS_PIN                    0x0   // DSx = 0 selects CLCINA/B/C/D for DS1/2/3/4
+
+// CLCxSEL data sources, CLC_CONFIG.source[0] = CLC_DS1_xxx ... source[3] = CLC_DS4_xxx
+#define CLC_DS1_PIN                   0x0   // CLCINA
+#define CLC_DS1_FOSC                  0x1
+#define CLC_DS1_CLC3                  0x2
+#define CLC_DS1_LPRC                  0x3
+#define CLC_DS1_REFCLKO               0x4
+#define CLC_DS1_SPI1_SDO              0x5
+#define CLC_DS1_UART1_TX              0x6
+#define CLC_DS1_PWM_EVTA              0x7   // PWM Event A output
+
+#define CLC_DS2_PIN                   0x0   // CLCINB
+#define CLC_DS2_CLC4                  0x1
+#define CLC_DS2_CMP1                  0x2   // comparator 1 output
+#define CLC_DS2_SCCP1                 0x3   // SCCP1 compare/PWM output
+#define CLC_DS2_SPI1_SDI              0x5
+#define CLC_DS2_UART1_RX              0x6
+#define CLC_DS2_PWM_EVTB              0x7
+
+#define CLC_DS3_PIN                   0x0   // CLCINC
+#define CLC_DS3_CLC1                  0x2
+#define CLC_DS3_CMP2                  0x3
+#define CLC_DS3_SCCP2                 0x4
+#define CLC_DS3_SCCP3                 0x5   // PWMA output
+#define CLC_DS3_PWM_EVTC              0x7
+
+#define CLC_DS4_PIN                   0x0   // CLCIND
+#define CLC_DS4_CLC2                  0x3
+#define CLC_DS4_CMP3                  0x4
+#define CLC_DS4_SCCP4                 0x6
+#define CLC_DS4_PWM_EVTD              0x7
+
+#define CLC_D1N                       0x01  // gate inputs, OR them into CLC_CONFIG.gate[]
+#define CLC_D1T                       0x02  // N = inverted data input, T = true data input
+#define CLC_D2N                       0x04
+#define CLC_D2T                       0x08
+#define CLC_D3N                       0x10
+#define CLC_D3T                       0x20
+#define CLC_D4N                       0x40
+#define CLC_D4T                       0x80
+
+#define CLC_IN_A                      0x0   // CLCINA, DS1 source 0
+#define CLC_IN_B                      0x1   // CLCINB, DS2 source 0
+#define CLC_IN_C                      0x2   // CLCINC, DS3 source 0
+#define CLC_IN_D                      0x3   // CLCIND, DS4 source 0
+
+
+typedef struct _CLC_CONFIG_STRUCT {
+    uint8_t                 mode;                                               // CLC_MODE_xxx
+    uint8_t                 source[4];                                          // DS1-DS4 data source, CLC_DS1_xxx - CLC_DS4_xxx
+    uint8_t                 gate[4];                                            // G1-G4 inputs, CLC_DxN/CLC_DxT
+    uint8_t                 gate_invert;                                        // bit n inverts gate n+1 output
+    bool                    output_invert;
+} CLC_CONFIG;
+
+
+// *****************************************************************************
+// CLC Function Call Definitions
+// Logic runs in hardware, no CPU cycles once configured
+//
+// Example, PWMA gated by an enable pin: source[2] = CLC_DS3_SCCP3,
+// source[1] = CLC_DS2_PIN with CLC_SetInputPin(CLC_IN_B, pin),
+// gate[0] = CLC_D3T, gate[1] = CLC_D2T, mode = CLC_MODE_AND_OR
+//
+// Example, PWMA cut off while comparator 1 trips: source[2] = CLC_DS3_SCCP3,
+// source[1] = CLC_DS2_CMP1, gate[0] = CLC_D3T, gate[1] = CLC_D2N,
+// mode = CLC_MODE_AND_OR
+// *****************************************************************************
+
+/**
+  @Description
+    Configures a CLC: data source select, gate logic, polarity and mode.
+    The CLC is left disabled, call CLC_Enable()
+
+  @Param
+    _clc = [CLC1, CLC2, CLC3, CLC4]
+    _config = logic cell configuration
+
+  @Returns
+    None
+*/
+void CLC_Initialize( uint8_t _clc, const CLC_CONFIG *_config );
+
+/**
+  @Description
+    Enable CLC
+
+  @Param
+    _clc = [CLC1, CLC2, CLC3, CLC4]
+
+  @Returns
+    None
+*/
+void CLC_Enable( uint8_t _clc );
+
+/**
+  @Description
+    Disable CLC
+
+  @Param
+    _clc = [CLC1, CLC2, CLC3, CLC4]
+
+  @Returns
+    None
+*/
+void CLC_Disable( uint8_t _clc );
+
+/**
+  @Description
+    Reads the current CLC output
+
+  @Param
+    _clc = [CLC1, CLC2, CLC3, CLC4]
+
+  @Returns
+    HIGH or LOW
+*/
+bool CLC_GetOutput( uint8_t _clc );
+
+/**
+  @Description
+    Maps a pin to one of the CLC input pins through PPS
+
+  @Param
+    _input = [CLC_IN_A, CLC_IN_B, CLC_IN_C, CLC_IN_D]
+    _pin = [PB0-PB15]
+
+  @Returns
+    None
+*/
+void CLC_SetInputPin( uint8_t _input, uint8_t _pin );
+
+/**
+  @Description
+    Drives a pin with the CLC output through PPS
+
+  @Param
+    _clc = [CLC1, CLC2, CLC3, CLC4]
+    _pin = [PB0-PB15]
+
+  @Returns
+    None
+*/
+void CLC_SetOutputPin( uint8_t _clc, uint8_t _pin );
+
+
+#endif //_DSPIC33CK_CLC_H
@@ -60,6 +60,48 @@
 #pragma config JTAGEN = OFF             //JTAG Enable bit->JTAG is disabled
 #pragma config NOBTSWP = DISABLED       //BOOTSWP instruction disable bit->BOOTSWP instruction is disabled
 
+#if DMT_EN
+// 1ms control loop: window opens at 0.8ms, timeout at 1.2ms, both counted in instruction cycles (Fcy)
+#if CLOCK_SystemFrequencyGet() == _8MHZ
+// FDMTIVTL
+#pragma config DMTIVTL = 0x0C80         //Dead Man Timer Interval low word->3200
+
+// FDMTCNTL
+#pragma config DMTCNTL = 0x12C0         //Lower 16 bits of 32 bit DMT instruction count time-out value (0-0xFFFF)->4800
+#elif CLOCK_SystemFrequencyGet() == _16MHZ
+// FDMTIVTL
+#pragma config DMTIVTL = 0x1900         //Dead Man Timer Interval low word->6400
+
+// FDMTCNTL
+#pragma config DMTCNTL = 0x2580         //Lower 16 bits of 32 bit DMT instruction count time-out value (0-0xFFFF)->9600
+#elif CLOCK_SystemFrequencyGet() == _20MHZ
+// FDMTIVTL
+#pragma config DMTIVTL = 0x1F40         //Dead Man Timer Interval low word->8000
+
+// FDMTCNTL
+#pragma config DMTCNTL = 0x2EE0         //Lower 16 bits of 32 bit DMT instruction count time-out value (0-0xFFFF)->12000
+#elif CLOCK_SystemFrequencyGet() == _50MHZ
+// FDMTIVTL
+#pragma config DMTIVTL = 0x4E20         //Dead Man Timer Interval low word->20000
+
+// FDMTCNTL
+#pragma config DMTCNTL = 0x7530         //Lower 16 bits of 32 bit DMT instruction count time-out value (0-0xFFFF)->30000
+#elif CLOCK_SystemFrequencyGet() == _100MHZ
+// FDMTIVTL
+#pragma config DMTIVTL = 0x9C40         //Dead Man Timer Interval low word->40000
+
+// FDMTCNTL
+#pragma config DMTCNTL = 0xEA60         //Lower 16 bits of 32 bit DMT instruction count time-out value (0-0xFFFF)->60000
+#else
+#error "DMT_EN: no DMTIVTL/DMTCNTL values for this CLOCK_SystemFrequencyGet(), add a 0.8ms window and 1.2ms timeout in instruction cycles"
+#endif
+
+// FDMTIVTH
+#pragma config DMTIVTH = 0              //Dead Man Timer Interval high word->0
+
+// FDMTCNTH
+#pragma config DMTCNTH = 0              //Upper 16 bits of 32 bit DMT instruction count time-out value (0-0xFFFF)->0
+#else
 // FDMTIVTL
 #pragma config DMTIVTL = 0              //Dead Man Timer Interval low word->0
 
@@ -71,6 +113,7 @@
 
 // FDMTCNTH
 #pragma config DMTCNTH = 0              //Upper 16 bits of 32 bit DMT instruction count time-out value (0-0xFFFF)->0
+#endif
 
 // FDMT
 #pragma config DMTDIS = OFF             //Dead Man Timer Disable bit->Dead Man Timer is Disabled and can be enabled by software
@@ -83,10 +126,17 @@
 #pragma config SPI2PIN = PPS            //SPI2 Pin Select bit->SPI2 uses I/O remap (PPS) pins
 
 // FALTREG
+#if ALTWREG_EN
+#pragma config CTXT1 = IPL5             //Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 1 bits->Alternate Register set assigned to IPL level 5
+#pragma config CTXT2 = IPL4             //Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 2 bits->Alternate Register set assigned to IPL level 4
+#pragma config CTXT3 = IPL2             //Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 3 bits->Alternate Register set assigned to IPL level 2
+#pragma config CTXT4 = IPL1             //Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 4 bits->Alternate Register set assigned to IPL level 1
+#else
 #pragma config CTXT1 = OFF              //Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 1 bits->Not Assigned
 #pragma config CTXT2 = OFF              //Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 2 bits->Not Assigned
 #pragma config CTXT3 = OFF              //Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 3 bits->Not Assigned
 #pragma config CTXT4 = OFF              //Specifies Interrupt Priority Level (IPL) Associated to Alternate Working Register 4 bits->Not Assigned
+#endif
 
 // FBTSEQ
 #pragma config BSEQ = 4095              //Relative value defining which partition will be active after device Reset; the partition containing a lower boot number will be active->4095
@@ -96,6 +146,12 @@
 #pragma config BTMODE = SINGLE          //Device Boot Mode Configuration->Device is in Single Boot (legacy) mode
 
 
+#define FRC_INSTRUCTION_CYCLES_PER_US       4                                   // FRC = 8MHz, FOSC/2 = 4MHz before the clock switch
+
+
+static uint32_t boot_time_us;
+
+
 void SYS_INIT( void ) {
     
     GPIO_Initialize();
@@ -110,10 +166,67 @@ void SYS_INIT( void ) {
     if (SCCP2_EN){
         SCCP2_Initialize();
     }
+    if (SCCP9_EN) {
+        SCCP9_Initialize();
+    }
+}
+
+
+uint16_t SYS_FastInit( uint8_t _channel ) {
+    uint32_t lock_cycles;
+    uint32_t total_cycles;
+    uint16_t sample;
+
+    SYSCLOCK_SwitchRequest();                                                   // PLL starts locking from here
+    SCCP9_Initialize();                                                         // measure boot time in instruction cycles
+
+    GPIO_Initialize();
+    Analog_BeginPin(_channel);                                                  // ADC core warms up while the PLL locks
+
+    if (TIMER1_EN) {
+        TIMER1_Initialize();
+    }
+    if (SCCP1_EN) {
+        SCCP1_Initialize();
+    }
+    if (SCCP2_EN){
+        SCCP2_Initialize();
+    }
+
+    lock_cycles = SCCP9_Read();                                                 // everything up to here is counted at the FRC rate
+    SYSCLOCK_WaitLock();
+    Analog_FinishPin();
+    sample = ADC1_Read(_channel);
+    total_cycles = SCCP9_Read();
+
+    if (CLOCK_SystemFrequencyGet() == _8MHZ) {
+        boot_time_us = total_cycles / FRC_INSTRUCTION_CYCLES_PER_US;
+    }
+    else {
+        boot_time_us = (lock_cycles / FRC_INSTRUCTION_CYCLES_PER_US) + SCCP9_CyclesToMicroseconds(total_cycles - lock_cycles);
+    }
+
+    if (!SCCP9_EN) {
+        SCCP9_Stop();
+        PMD_ModuleDisable(PMD_CCP9);                                            // release SCCP9, only needed for the boot time
+    }
+
+    return sample;
+}
+
+
+uint32_t SYS_GetBootTime( void ) {
+    return boot_time_us;
 }
 
 
 void SYSCLOCK_Initialize( void ) {
+    SYSCLOCK_SwitchRequest();
+    SYSCLOCK_WaitLock();
+}
+
+
+void SYSCLOCK_SwitchRequest( void ) {
 
     CLKDIV = 0x3001;                    // FRCDIV FRC/1; PLLPRE 1; DOZE 1:8; DOZEN disabled; ROI disabled;
     PLLFBD = 0x64;                      // PLLFBDIV 100;
@@ -157,13 +270,7 @@ void SYSCLOCK_Initialize( void ) {
     REFOTRIMH = 0x00;                   // ROTRIM 0;
     RPCON = 0x00;                       // IOLOCK disabled;
     PMDCON = 0x00;                      // PMDLOCK disabled;
-    PMD1 = 0x00;                        // ADC1MD enabled; T1MD enabled; U2MD enabled; U1MD enabled; SPI2MD enabled; SPI1MD enabled; QEI1MD enabled; PWMMD enabled; I2C1MD enabled;
-    PMD2 = 0x00;                        // CCP2MD enabled; CCP1MD enabled; CCP4MD enabled; CCP3MD enabled; CCP7MD enabled; CCP8MD enabled; CCP5MD enabled; CCP6MD enabled; CCP9MD enabled;
-    PMD3 = 0x00;                        // I2C3MD enabled; U3MD enabled; QEI2MD enabled; CRCMD enabled; I2C2MD enabled;
-    PMD4 = 0x00;                        // REFOMD enabled;
-    PMD6 = 0x00;                        // DMA1MD enabled; SPI3MD enabled; DMA2MD enabled; DMA3MD enabled; DMA0MD enabled;
-    PMD7 = 0x00;                        // CMP3MD enabled; PTGMD enabled; CMP1MD enabled; CMP2MD enabled; 
-    PMD8 = 0x00;                        // DMTMD enabled; CLC3MD enabled; OPAMPMD enabled; BIASMD enabled; CLC4MD enabled; SENT2MD enabled; SENT1MD enabled; CLC1MD enabled; CLC2MD enabled;
+    PMD_Initialize();
 
     if (CLOCK_SystemFrequencyGet() == 8000000UL) {
         // CF no clock failure; NOSC FRC; CLKLOCK unlocked; OSWEN Switch is Complete; 
@@ -175,7 +282,13 @@ void SYSCLOCK_Initialize( void ) {
         // CF no clock failure; NOSC FRCPLL; CLKLOCK unlocked; OSWEN Switch is Complete; 
         __builtin_write_OSCCONH((uint8_t) (0x01));
         __builtin_write_OSCCONL((uint8_t) (0x01));
-        
+    }
+}
+
+
+void SYSCLOCK_WaitLock( void ) {
+
+    if (CLOCK_SystemFrequencyGet() != 8000000UL) {
         // Wait for Clock switch to occur
         while (OSCCONbits.OSWEN != 0);
         while (OSCCONbits.LOCK != 1);
@@ -185,6 +298,312 @@ void SYSCLOCK_Initialize( void ) {
 }
 
 
+void PMD_Initialize( void ) {
+
+    if (PMD_GATING_EN) {
+        PMD1 = 0xFFFF;                  // ADC1MD, T1MD, U2MD, U1MD, SPI2MD, SPI1MD, QEI1MD, PWMMD, I2C1MD disabled;
+        PMD2 = 0xFFFF;                  // CCP1MD - CCP9MD disabled;
+        PMD3 = 0xFFFF;                  // I2C3MD, U3MD, QEI2MD, CRCMD, I2C2MD disabled;
+        PMD4 = 0xFFFF;                  // REFOMD disabled;
+        PMD6 = 0xFFFF;                  // DMA0MD - DMA3MD, SPI3MD disabled;
+        PMD7 = 0xFFFF;                  // CMP1MD - CMP3MD, PTGMD disabled;
+        PMD8 = 0xFFFF;                  // DMTMD, CLC1MD - CLC4MD, OPAMPMD, BIASMD, SENT1MD, SENT2MD disabled;
+    }
+    else {
+        PMD1 = 0x00;                    // ADC1MD enabled; T1MD enabled; U2MD enabled; U1MD enabled; SPI2MD enabled; SPI1MD enabled; QEI1MD enabled; PWMMD enabled; I2C1MD enabled;
+        PMD2 = 0x00;                    // CCP2MD enabled; CCP1MD enabled; CCP4MD enabled; CCP3MD enabled; CCP7MD enabled; CCP8MD enabled; CCP5MD enabled; CCP6MD enabled; CCP9MD enabled;
+        PMD3 = 0x00;                    // I2C3MD enabled; U3MD enabled; QEI2MD enabled; CRCMD enabled; I2C2MD enabled;
+        PMD4 = 0x00;                    // REFOMD enabled;
+        PMD6 = 0x00;                    // DMA1MD enabled; SPI3MD enabled; DMA2MD enabled; DMA3MD enabled; DMA0MD enabled;
+        PMD7 = 0x00;                    // CMP3MD enabled; PTGMD enabled; CMP1MD enabled; CMP2MD enabled; 
+        PMD8 = 0x00;                    // DMTMD enabled; CLC3MD enabled; OPAMPMD enabled; BIASMD enabled; CLC4MD enabled; SENT2MD enabled; SENT1MD enabled; CLC1MD enabled; CLC2MD enabled;
+    }
+}
+
+
+static void PMD_SetModuleState( uint8_t _module, bool _disable ) {
+    switch (_module) {
+        case PMD_ADC1:
+            PMD1bits.ADC1MD = _disable;
+            break;
+        case PMD_T1:
+            PMD1bits.T1MD = _disable;
+            break;
+        case PMD_U1:
+            PMD1bits.U1MD = _disable;
+            break;
+        case PMD_U2:
+            PMD1bits.U2MD = _disable;
+            break;
+        case PMD_SPI1:
+            PMD1bits.SPI1MD = _disable;
+            break;
+        case PMD_SPI2:
+            PMD1bits.SPI2MD = _disable;
+            break;
+        case PMD_QEI1:
+            PMD1bits.QEI1MD = _disable;
+            break;
+        case PMD_PWM:
+            PMD1bits.PWMMD = _disable;
+            break;
+        case PMD_I2C1:
+            PMD1bits.I2C1MD = _disable;
+            break;
+        case PMD_CCP1:
+            PMD2bits.CCP1MD = _disable;
+            break;
+        case PMD_CCP2:
+            PMD2bits.CCP2MD = _disable;
+            break;
+        case PMD_CCP3:
+            PMD2bits.CCP3MD = _disable;
+            break;
+        case PMD_CCP4:
+            PMD2bits.CCP4MD = _disable;
+            break;
+        case PMD_CCP5:
+            PMD2bits.CCP5MD = _disable;
+            break;
+        case PMD_CCP6:
+            PMD2bits.CCP6MD = _disable;
+            break;
+        case PMD_CCP7:
+            PMD2bits.CCP7MD = _disable;
+            break;
+        case PMD_CCP8:
+            PMD2bits.CCP8MD = _disable;
+            break;
+        case PMD_CCP9:
+            PMD2bits.CCP9MD = _disable;
+            break;
+        case PMD_I2C2:
+            PMD3bits.I2C2MD = _disable;
+            break;
+        case PMD_I2C3:
+            PMD3bits.I2C3MD = _disable;
+            break;
+        case PMD_U3:
+            PMD3bits.U3MD = _disable;
+            break;
+        case PMD_QEI2:
+            PMD3bits.QEI2MD = _disable;
+            break;
+        case PMD_CRC:
+            PMD3bits.CRCMD = _disable;
+            break;
+        case PMD_REFO:
+            PMD4bits.REFOMD = _disable;
+            break;
+        case PMD_DMA0:
+            PMD6bits.DMA0MD = _disable;
+            break;
+        case PMD_DMA1:
+            PMD6bits.DMA1MD = _disable;
+            break;
+        case PMD_DMA2:
+            PMD6bits.DMA2MD = _disable;
+            break;
+        case PMD_DMA3:
+            PMD6bits.DMA3MD = _disable;
+            break;
+        case PMD_SPI3:
+            PMD6bits.SPI3MD = _disable;
+            break;
+        case PMD_CMP1:
+            PMD7bits.CMP1MD = _disable;
+            break;
+        case PMD_CMP2:
+            PMD7bits.CMP2MD = _disable;
+            break;
+        case PMD_CMP3:
+            PMD7bits.CMP3MD = _disable;
+            break;
+        case PMD_PTG:
+            PMD7bits.PTGMD = _disable;
+            break;
+        case PMD_DMT:
+            PMD8bits.DMTMD = _disable;
+            break;
+        case PMD_CLC1:
+            PMD8bits.CLC1MD = _disable;
+            break;
+        case PMD_CLC2:
+            PMD8bits.CLC2MD = _disable;
+            break;
+        case PMD_CLC3:
+            PMD8bits.CLC3MD = _disable;
+            break;
+        case PMD_CLC4:
+            PMD8bits.CLC4MD = _disable;
+            break;
+        case PMD_OPAMP:
+            PMD8bits.OPAMPMD = _disable;
+            break;
+        case PMD_BIAS:
+            PMD8bits.BIASMD = _disable;
+            break;
+        case PMD_SENT1:
+            PMD8bits.SENT1MD = _disable;
+            break;
+        case PMD_SENT2:
+            PMD8bits.SENT2MD = _disable;
+            break;
+    }
+}
+
+
+void PMD_ModuleEnable( uint8_t _module ) {
+    PMD_SetModuleState(_module, false);
+}
+
+
+void PMD_ModuleDisable( uint8_t _module ) {
+    PMD_SetModuleState(_module, true);
+}
+
+
+bool PMD_IsModuleEnabled( uint8_t _module ) {
+    switch (_module) {
+        case PMD_ADC1:
+            return !PMD1bits.ADC1MD;
+        case PMD_T1:
+            return !PMD1bits.T1MD;
+        case PMD_U1:
+            return !PMD1bits.U1MD;
+        case PMD_U2:
+            return !PMD1bits.U2MD;
+        case PMD_SPI1:
+            return !PMD1bits.SPI1MD;
+        case PMD_SPI2:
+            return !PMD1bits.SPI2MD;
+        case PMD_QEI1:
+            return !PMD1bits.QEI1MD;
+        case PMD_PWM:
+            return !PMD1bits.PWMMD;
+        case PMD_I2C1:
+            return !PMD1bits.I2C1MD;
+        case PMD_CCP1:
+            return !PMD2bits.CCP1MD;
+        case PMD_CCP2:
+            return !PMD2bits.CCP2MD;
+        case PMD_CCP3:
+            return !PMD2bits.CCP3MD;
+        case PMD_CCP4:
+            return !PMD2bits.CCP4MD;
+        case PMD_CCP5:
+            return !PMD2bits.CCP5MD;
+        case PMD_CCP6:
+            return !PMD2bits.CCP6MD;
+        case PMD_CCP7:
+            return !PMD2bits.CCP7MD;
+        case PMD_CCP8:
+            return !PMD2bits.CCP8MD;
+        case PMD_CCP9:
+            return !PMD2bits.CCP9MD;
+        case PMD_I2C2:
+            return !PMD3bits.I2C2MD;
+        case PMD_I2C3:
+            return !PMD3bits.I2C3MD;
+        case PMD_U3:
+            return !PMD3bits.U3MD;
+        case PMD_QEI2:
+            return !PMD3bits.QEI2MD;
+        case PMD_CRC:
+            return !PMD3bits.CRCMD;
+        case PMD_REFO:
+            return !PMD4bits.REFOMD;
+        case PMD_DMA0:
+            return !PMD6bits.DMA0MD;
+        case PMD_DMA1:
+            return !PMD6bits.DMA1MD;
+        case PMD_DMA2:
+            return !PMD6bits.DMA2MD;
+        case PMD_DMA3:
+            return !PMD6bits.DMA3MD;
+        case PMD_SPI3:
+            return !PMD6bits.SPI3MD;
+        case PMD_CMP1:
+            return !PMD7bits.CMP1MD;
+        case PMD_CMP2:
+            return !PMD7bits.CMP2MD;
+        case PMD_CMP3:
+            return !PMD7bits.CMP3MD;
+        case PMD_PTG:
+            return !PMD7bits.PTGMD;
+        case PMD_DMT:
+            return !PMD8bits.DMTMD;
+        case PMD_CLC1:
+            return !PMD8bits.CLC1MD;
+        case PMD_CLC2:
+            return !PMD8bits.CLC2MD;
+        case PMD_CLC3:
+            return !PMD8bits.CLC3MD;
+        case PMD_CLC4:
+            return !PMD8bits.CLC4MD;
+        case PMD_OPAMP:
+            return !PMD8bits.OPAMPMD;
+        case PMD_BIAS:
+            return !PMD8bits.BIASMD;
+        case PMD_SENT1:
+            return !PMD8bits.SENT1MD;
+        case PMD_SENT2:
+            return !PMD8bits.SENT2MD;
+    }
+    return false;
+}
+
+
+static const uint16_t int_budget[][3] = {                                       // { IPL, estimated handler cycles, CPULOAD source }
+    { DDS_IPL, DDS_ISR_CYCLES, CPULOAD_DDS },
+    { SCCP2_IPL, SCCP2_ISR_CYCLES, CPULOAD_SCCP2 },
+    { ADC_IPL, ADC_ISR_CYCLES, CPULOAD_ADC },
+    { PWMA_IPL, PWMA_ISR_CYCLES, CPULOAD_PWMA },
+    { CAPTURE_IPL, CAPTURE_ISR_CYCLES, CPULOAD_CAPTURE },
+    { QEI1_IPL, QEI1_ISR_CYCLES, CPULOAD_QEI1 },
+    { PWMFLT_IPL, PWMFLT_ISR_CYCLES, CPULOAD_PWMFLT },
+    { SCCP1_IPL, SCCP1_ISR_CYCLES, CPULOAD_SCCP1 },
+    { I2C1_IPL, I2C1_ISR_CYCLES, CPULOAD_I2C1 },
+    { INPUT_IPL, INPUT_ISR_CYCLES, CPULOAD_INPUT },
+    { SPI1_IPL, SPI1_ISR_CYCLES, CPULOAD_SPI1 },
+    { TIMER1_IPL, TIMER1_ISR_CYCLES, CPULOAD_TIMER1 },
+    { CRC_IPL, CRC_ISR_CYCLES, CPULOAD_CRC },
+    { SCCP9_IPL, SCCP9_ISR_CYCLES, 0xFF },                                      // not instrumented
+};
+
+
+static uint16_t INT_GetHandlerCycles( uint8_t _index ) {
+    uint16_t measured;
+
+    if (!CPULOAD_EN) {
+        return int_budget[_index][1];
+    }
+    measured = CPULoad_GetLongest((uint8_t) int_budget[_index][2]);
+    return (measured > int_budget[_index][1]) ? measured : int_budget[_index][1];
+}
+
+
+uint16_t INT_GetWorstCaseLatency( uint8_t _level ) {
+    uint16_t blocking;
+    uint16_t preempting;
+    uint16_t cycles;
+    uint8_t i;
+
+    blocking = 0;
+    preempting = 0;
+    for (i = 0; i < sizeof(int_budget) / sizeof(int_budget[0]); i++) {
+        cycles = INT_GetHandlerCycles(i);
+        if (int_budget[i][0] > _level) {
+            preempting += INT_ENTRY_CYCLES + cycles;                            // every higher handler may run once
+        }
+        else if (int_budget[i][0] == _level && cycles > blocking) {
+            blocking = cycles;                                                  // no nesting within a level
+        }
+    }
+    return INT_ENTRY_CYCLES + blocking + preempting;
+}
+
+
 void GPIO_Initialize( void ) {
 
     TRISA = 0x001F;                     // initialize all as INPUT
@@ -408,4 +827,133 @@ bool Digital_ReadPin( uint8_t _pin ) {
             return _RB15;
     }
     return false;
+}
+
+
+uint16_t Digital_ReadPort( uint8_t _port ) {
+    switch (_port) {
+        case PORT_A:
+            return PORTA;
+        case PORT_B:
+            return PORTB;
+    }
+    return 0;
+}
+
+
+void Digital_WritePort( uint8_t _port, uint16_t _mask, uint16_t _value ) {
+    __builtin_disi(0x3FFF);                                                     // no interrupt between reading and writing LATx
+    switch (_port) {
+        case PORT_A:
+            LATA = (LATA & ~_mask) | (_value & _mask);
+            break;
+        case PORT_B:
+            LATB = (LATB & ~_mask) | (_value & _mask);
+            break;
+    }
+    __builtin_disi(0x0000);
+}
+
+
+bool ParallelBus_Attach( PARALLEL_BUS *_bus, uint8_t _first_pin, uint8_t _width ) {
+    _bus->mask = 0x0000;
+    _bus->shift = 0;
+    if (_first_pin < PB0 || _first_pin > PB15 || _width == 0 || (_first_pin - PB0) + _width > 16) {
+        return false;
+    }
+
+    _bus->shift = _first_pin - PB0;
+    _bus->mask = (uint16_t) (((1UL << _width) - 1) << _bus->shift);
+
+    Digital_WritePort(PORT_B, _bus->mask, 0x0000);
+    TRISB = TRISB & ~_bus->mask;                                                // digital output
+    ANSELB = ANSELB & ~_bus->mask;
+
+    return true;
+}
+
+
+void ParallelBus_Write( PARALLEL_BUS *_bus, uint16_t _value ) {
+    Digital_WritePort(PORT_B, _bus->mask, _value << _bus->shift);
+}
+
+
+uint8_t PPS_GetRP( uint8_t _pin ) {
+    if (_pin >= PB0 && _pin <= PB15) {
+        return 32 + (_pin - PB0);
+    }
+    return 0;
+}
+
+
+uint8_t PPS_SetInputPin( uint8_t _pin ) {
+    uint16_t mask;
+
+    if (PPS_GetRP(_pin) == 0) {
+        return 0;
+    }
+    mask = PWMx_GetPinRegister(_pin);
+    TRISB = TRISB | mask;                                                       // set this pin as input
+    ANSELB = ANSELB & ~mask;                                                    // set this pin as digital
+    return PPS_GetRP(_pin);
+}
+
+
+void PPS_SetOutputPin( uint8_t _pin, uint8_t _function ) {
+
+    if (PPS_GetRP(_pin) == 0) {
+        return;
+    }
+    TRISB = TRISB & ~PWMx_GetPinRegister(_pin);                                 // set this pin as output
+
+    switch (PPS_GetRP(_pin)) {
+        case 32:
+            _RP32R = _function;
+            break;
+        case 33:
+            _RP33R = _function;
+            break;
+        case 34:
+            _RP34R = _function;
+            break;
+        case 35:
+            _RP35R = _function;
+            break;
+        case 36:
+            _RP36R = _function;
+            break;
+        case 37:
+            _RP37R = _function;
+            break;
+        case 38:
+            _RP38R = _function;
+            break;
+        case 39:
+            _RP39R = _function;
+            break;
+        case 40:
+            _RP40R = _function;
+            break;
+        case 41:
+            _RP41R = _function;
+            break;
+        case 42:
+            _RP42R = _function;
+            break;
+        case 43:
+            _RP43R = _function;
+            break;
+        case 44:
+            _RP44R = _function;
+            break;
+        case 45:
+            _RP45R = _function;
+            break;
+        case 46:
+            _RP46R = _function;
+            break;
+        case 47:
+            _RP47R = _function;
+            break;
+    }
 }
\ No newline at end of file
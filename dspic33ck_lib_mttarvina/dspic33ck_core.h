@@ -15,6 +15,22 @@
 #include "dspic33ck_time.h"
 #include "dspic33ck_analog.h"
 #include "dspic33ck_pwm.h"
+#include "dspic33ck_qei.h"
+#include "dspic33ck_spi.h"
+#include "dspic33ck_i2c.h"
+#include "dspic33ck_crc.h"
+#include "dspic33ck_capture.h"
+#include "dspic33ck_input.h"
+#include "dspic33ck_clc.h"
+#include "dspic33ck_afe.h"
+#include "dspic33ck_dds.h"
+#include "dspic33ck_scope.h"
+#include "dspic33ck_dmt.h"
+#include "dspic33ck_cpuload.h"
+#include "dspic33ck_trace.h"
+#include "dspic33ck_math.h"
+#include "dspic33ck_foc.h"
+#include "dspic33ck_meter.h"
 
 
 // SYSTEM MACROS
@@ -41,6 +57,106 @@
 #define TIMER1_EN                           true                                // enables usage of delay_ms()
 #define SCCP1_EN                            true                                // enables usage of milliseconds() and seconds()
 #define SCCP2_EN                            true                                // enables usage of sccp2 as sampling trigger for ADC
+#define I2C1_EN                             false                               // enables I2C1 transaction timeouts in the SCCP1 tick
+#define INPUT_EN                            false                               // enables change notification input debouncing in the SCCP1 tick
+#define SCCP9_EN                            false                               // enables usage of sccp9 as free-running instruction cycle counter
+#define PMD_GATING_EN                       true                                // power down every peripheral at startup, drivers power up only what they use
+#define ALTWREG_EN                          false                               // library ISRs run on alternate working registers, no W register save/restore
+#define DMT_EN                              false                               // arms the Dead Man Timer control loop monitor, set FDMTCNT and FDMTIVT in dspic33ck_core.c
+#define CPULOAD_EN                          false                               // enables CPU load and per-interrupt accounting, closed in the SCCP1 tick
+#define TRACE_EN                            false                               // enables binary event tracing over UART1, time sync records sent from the SCCP1 tick
+#define FOC_EN                              false                               // enables the PG1 - PG3 motor PWM and the AN0/AN1 current loop interrupt
+
+
+// INTERRUPT PRIORITY MACROS
+// the only place library interrupt priorities are assigned, a higher level preempts a lower one
+// IPL 5: waveform output, must never be delayed by sampling
+// IPL 4: sampling and control, preempts every housekeeping tick
+// IPL 2: housekeeping ticks and comms, SCCP1, I2C1 and CN share a level so their tables are never accessed concurrently
+// IPL 1: background
+#define DDS_IPL                             5                                   // CCT6
+#define SCCP2_IPL                           4                                   // CCP2, CCT2 ADC sampling trigger
+#define ADC_IPL                             4                                   // ADC, ADCAN0 - ADCAN11
+#define PWMA_IPL                            4                                   // CCP3, CCT3
+#define CAPTURE_IPL                         4                                   // CCP4, CCP5
+#define QEI1_IPL                            4                                   // QEI1
+#define PWMFLT_IPL                          4                                   // PWM1 PCI fault, the outputs are already safe when it runs
+#define SCCP1_IPL                           2                                   // CCP1, CCT1 1ms tick
+#define I2C1_IPL                            2                                   // MI2C1
+#define INPUT_IPL                           2                                   // CNA, CNB
+#define SPI1_IPL                            2                                   // DMA1
+#define TIMER1_IPL                          1                                   // T1 delay_ms() tick
+#define CRC_IPL                             1                                   // CRC
+#define SCCP9_IPL                           1                                   // CCP9, CCT9 ALTWREG_MeasureSavings()
+
+// worst case instruction cycles of each handler body, used by INT_GetWorstCaseLatency()
+// these are estimates counted from the code, not measurements; with CPULOAD_EN the
+// longest run measured by CPULoad_GetLongest() replaces any estimate it exceeds
+// callbacks run from a handler (SPI1, input, ADC, PWM fault) are not included, except the FOC current loop
+// a handler that calls into other modules adds their path only when that module is enabled,
+// update the path defines when a module grows its part of a handler
+#define INT_ENTRY_CYCLES                    ((ALTWREG_EN ? 10 : 24) + (CPULOAD_EN ? CPULOAD_ISR_OVERHEAD : 0))  // vectoring + RETFIE, W register save/restore, load measurement
+#define DDS_ISR_CYCLES                      40
+#define SCCP2_ISR_CYCLES                    8
+#define FOC_LOOP_CYCLES                     540                                 // ADCAN1 current scaling and one FOC_CurrentControl() pass from its callback, unmeasured
+#define ADC_ISR_CYCLES                      (FOC_EN ? FOC_LOOP_CYCLES : 8)
+#define PWMA_ISR_CYCLES                     16
+#define CAPTURE_ISR_CYCLES                  90                                  // one FIFO entry, more if the FIFO has backed up
+#define QEI1_ISR_CYCLES                     12
+#define PWMFLT_ISR_CYCLES                   10
+#define SCCP1_TICK_CYCLES                   40                                  // millisecond counters
+#define I2C1_TICK_CYCLES                    80                                  // an I2C1 timeout or one bus recovery edge
+#define INPUT_TICK_CYCLES                   (15 * INPUT_MAX_PINS)               // a debounce pass over every pin
+#define CPULOAD_TICK_CYCLES                 1500                                // a window close, 32 bit divisions for every source
+#define TRACE_TICK_CYCLES                   60                                  // one sync record
+#define SCCP1_ISR_CYCLES                    (SCCP1_TICK_CYCLES + (I2C1_EN ? I2C1_TICK_CYCLES : 0) + (INPUT_EN ? INPUT_TICK_CYCLES : 0) \
+                                             + (CPULOAD_EN ? CPULOAD_TICK_CYCLES : 0) + (TRACE_EN ? TRACE_TICK_CYCLES : 0))
+#define I2C1_ISR_CYCLES                     80
+#define INPUT_ISR_CYCLES                    120
+#define SPI1_ISR_CYCLES                     30
+#define TIMER1_ISR_CYCLES                   10
+#define CRC_ISR_CYCLES                      60
+#define SCCP9_ISR_CYCLES                    8
+
+#if DDS_IPL < 1 || DDS_IPL > 7 || SCCP2_IPL < 1 || SCCP2_IPL > 7 || ADC_IPL < 1 || ADC_IPL > 7 \
+    || PWMA_IPL < 1 || PWMA_IPL > 7 || CAPTURE_IPL < 1 || CAPTURE_IPL > 7 || QEI1_IPL < 1 || QEI1_IPL > 7 \
+    || PWMFLT_IPL < 1 || PWMFLT_IPL > 7 \
+    || SCCP1_IPL < 1 || SCCP1_IPL > 7 || I2C1_IPL < 1 || I2C1_IPL > 7 || INPUT_IPL < 1 || INPUT_IPL > 7 \
+    || SPI1_IPL < 1 || SPI1_IPL > 7 || TIMER1_IPL < 1 || TIMER1_IPL > 7 || CRC_IPL < 1 || CRC_IPL > 7 \
+    || SCCP9_IPL < 1 || SCCP9_IPL > 7
+#error "interrupt priorities must be 1 - 7"
+#endif
+#if I2C1_IPL != SCCP1_IPL || INPUT_IPL != SCCP1_IPL
+#error "I2C1_IPL and INPUT_IPL must equal SCCP1_IPL, the SCCP1 tick shares their state"
+#endif
+#if SCCP2_IPL <= SCCP1_IPL || ADC_IPL <= SCCP1_IPL || PWMA_IPL <= SCCP1_IPL || CAPTURE_IPL <= SCCP1_IPL || QEI1_IPL <= SCCP1_IPL \
+    || PWMFLT_IPL <= SCCP1_IPL
+#error "sampling and control interrupts must preempt the SCCP1 tick"
+#endif
+#if SCCP1_IPL <= TIMER1_IPL
+#error "the SCCP1 tick must preempt TIMER1"
+#endif
+#if DDS_IPL <= ADC_IPL || DDS_IPL <= SCCP2_IPL
+#error "DDS_IPL must be above the sampling interrupts"
+#endif
+
+
+// ALTERNATE WORKING REGISTER MACROS
+// CTXT1 = IPL5, CTXT2 = IPL4, CTXT3 = IPL2, CTXT4 = IPL1, see INTERRUPT PRIORITY MACROS
+// every library ISR runs at one of these levels, an ISR at any other level must not use ISR_CONTEXT
+#if ALTWREG_EN
+#define ISR_CONTEXT                         , context                           // appended to the interrupt attribute list
+#else
+#define ISR_CONTEXT
+#endif
+
+#define IPL_HAS_CONTEXT(ipl)                ((ipl) == 5 || (ipl) == 4 || (ipl) == 2 || (ipl) == 1)
+#if ALTWREG_EN && (!IPL_HAS_CONTEXT(DDS_IPL) || !IPL_HAS_CONTEXT(SCCP2_IPL) || !IPL_HAS_CONTEXT(ADC_IPL) \
+    || !IPL_HAS_CONTEXT(PWMA_IPL) || !IPL_HAS_CONTEXT(CAPTURE_IPL) || !IPL_HAS_CONTEXT(QEI1_IPL) || !IPL_HAS_CONTEXT(PWMFLT_IPL) \
+    || !IPL_HAS_CONTEXT(SCCP1_IPL) || !IPL_HAS_CONTEXT(SPI1_IPL) || !IPL_HAS_CONTEXT(TIMER1_IPL) \
+    || !IPL_HAS_CONTEXT(CRC_IPL) || !IPL_HAS_CONTEXT(SCCP9_IPL))
+#error "with ALTWREG_EN every library interrupt must run at a level with an alternate register set"
+#endif
 
 
 #define INPUT                               true                                // used in Digital_SetPin()
@@ -76,6 +192,69 @@
 #define PB15                                0x15
 
 
+// PPS OUTPUT FUNCTION MACROS
+#define PPS_OUT_NONE                        0x00                                // pin is driven by LATx
+#define PPS_OUT_U1TX                        0x01
+#define PPS_OUT_SDO1                        0x05
+#define PPS_OUT_SCK1                        0x06
+#define PPS_OUT_SS1                         0x07
+#define PPS_OUT_CLC1                        0x28
+#define PPS_OUT_CLC2                        0x29
+#define PPS_OUT_CLC3                        0x2A
+#define PPS_OUT_CLC4                        0x2B
+
+
+// PERIPHERAL MODULE DISABLE (PMD) MACROS
+#define PMD_ADC1                            0x01
+#define PMD_T1                              0x02
+#define PMD_U1                              0x03
+#define PMD_U2                              0x04
+#define PMD_SPI1                            0x05
+#define PMD_SPI2                            0x06
+#define PMD_QEI1                            0x07
+#define PMD_PWM                             0x08
+#define PMD_I2C1                            0x09
+#define PMD_CCP1                            0x0A
+#define PMD_CCP2                            0x0B
+#define PMD_CCP3                            0x0C
+#define PMD_CCP4                            0x0D
+#define PMD_CCP5                            0x0E
+#define PMD_CCP6                            0x0F
+#define PMD_CCP7                            0x10
+#define PMD_CCP8                            0x11
+#define PMD_CCP9                            0x12
+#define PMD_I2C2                            0x13
+#define PMD_I2C3                            0x14
+#define PMD_U3                              0x15
+#define PMD_QEI2                            0x16
+#define PMD_CRC                             0x17
+#define PMD_REFO                            0x18
+#define PMD_DMA0                            0x19
+#define PMD_DMA1                            0x1A
+#define PMD_DMA2                            0x1B
+#define PMD_DMA3                            0x1C
+#define PMD_SPI3                            0x1D
+#define PMD_CMP1                            0x1E
+#define PMD_CMP2                            0x1F
+#define PMD_CMP3                            0x20
+#define PMD_PTG                             0x21
+#define PMD_DMT                             0x22
+#define PMD_CLC1                            0x23
+#define PMD_CLC2                            0x24
+#define PMD_CLC3                            0x25
+#define PMD_CLC4                            0x26
+#define PMD_OPAMP                           0x27
+#define PMD_BIAS                            0x28
+#define PMD_SENT1                           0x29
+#define PMD_SENT2                           0x2A
+
+
+typedef struct _PARALLEL_BUS_STRUCT {
+    uint16_t                mask;                                               // LATB bits of the bus
+    uint8_t                 shift;                                              // LATB bit of the bus LSB
+} PARALLEL_BUS;
+
+
 /**
   @Description
     Initialize system
@@ -88,6 +267,35 @@
 */
 void SYS_INIT( void );
 
+/**
+  @Description
+    Initialize system with the shortest time to first ADC sample
+    The ADC core warm-up, GPIO and timer setup run while the PLL locks
+    instead of after it. Timers start counting before the clock switch
+    completes so their first period may be longer than configured
+
+  @Param
+    channel = ADC channel to be sampled first [AN0-AN11]
+
+  @Returns
+    first ADC sample of the channel
+*/
+uint16_t SYS_FastInit( uint8_t _channel );
+
+/**
+  @Description
+    Returns the time from the clock switch request to the end of the first
+    conversion measured by SYS_FastInit(). Cycles counted before the clock
+    switch completes are converted at the FRC rate, so this is an upper bound
+
+  @Param
+    None
+
+  @Returns
+    time to first sample in us, 0 if SYS_FastInit() was not used
+*/
+uint32_t SYS_GetBootTime( void );
+
 /**
   @Description
     Initialize system clock at startup
@@ -100,6 +308,101 @@ void SYS_INIT( void );
 */
 void SYSCLOCK_Initialize( void );
 
+/**
+  @Description
+    Configures the oscillator and PLL and requests the clock switch
+    Does not wait for the PLL to lock
+
+  @Param
+    None
+
+  @Returns
+    None
+*/
+void SYSCLOCK_SwitchRequest( void );
+
+/**
+  @Description
+    Waits for the clock switch requested by SYSCLOCK_SwitchRequest()
+    to complete and the PLL to lock
+
+  @Param
+    None
+
+  @Returns
+    None
+*/
+void SYSCLOCK_WaitLock( void );
+
+/**
+  @Description
+    Initialize the Peripheral Module Disable registers at startup
+    If PMD_GATING_EN is true, all peripherals are powered down and each
+    driver powers up its own module through PMD_ModuleEnable() on init
+
+  @Param
+    None
+
+  @Returns
+    None
+*/
+void PMD_Initialize( void );
+
+/**
+  @Description
+    Powers up a peripheral module
+    Must be called before writing to any register of that module
+
+  @Param
+    module = [PMD_ADC1, PMD_T1, PMD_CCP1, ...]
+
+  @Returns
+    None
+*/
+void PMD_ModuleEnable( uint8_t _module );
+
+/**
+  @Description
+    Powers down a peripheral module, all of its registers are reset
+
+  @Param
+    module = [PMD_ADC1, PMD_T1, PMD_CCP1, ...]
+
+  @Returns
+    None
+*/
+void PMD_ModuleDisable( uint8_t _module );
+
+/**
+  @Description
+    Checks if a peripheral module is powered
+
+  @Param
+    module = [PMD_ADC1, PMD_T1, PMD_CCP1, ...]
+
+  @Returns
+    true if the module is powered
+*/
+bool PMD_IsModuleEnabled( uint8_t _module );
+
+/**
+  @Description
+    Computes the worst case delay from an interrupt request at a level to
+    the first instruction of its handler, from the INTERRUPT PRIORITY MACROS
+    table: one handler already running at the same level plus one run of
+    every handler at a higher level
+    The *_ISR_CYCLES estimates are raised to the runs measured so far when
+    CPULOAD_EN is true, call it after the application has exercised its
+    worst case paths
+
+  @Param
+    _level = interrupt priority level [1 - 7], e.g. ADC_IPL
+
+  @Returns
+    latency in instruction cycles
+*/
+uint16_t INT_GetWorstCaseLatency( uint8_t _level );
+
 /**
   @Description
     Initialize default GPIO settings at startup
@@ -152,5 +455,100 @@ void Digital_DrvPin( uint8_t _pin, bool _state );
 */
 bool Digital_ReadPin( uint8_t _pin );
 
+/**
+  @Description
+    Reads all pins of a port in one access
+
+  @Param
+    port = [PORT_A, PORT_B]
+
+  @Returns
+    PORTx value, bit n = pin state of RAn/RBn
+*/
+uint16_t Digital_ReadPort( uint8_t _port );
+
+/**
+  @Description
+    Writes the masked pins of a port in one LATx write, other pins keep
+    their state. Interrupts are held off during the read-modify-write so
+    no LATx update from an ISR is lost
+
+  @Param
+    port = [PORT_A, PORT_B]
+    mask = pins to write, bit n = RAn/RBn
+    value = new pin states, bit n = RAn/RBn
+
+  @Returns
+    None
+*/
+void Digital_WritePort( uint8_t _port, uint16_t _mask, uint16_t _value );
+
+/**
+  @Description
+    Configures a group of adjacent PORTB pins as a parallel output bus
+    and drives it to 0. A rejected bus gets an empty mask, so
+    ParallelBus_Write() leaves every pin alone
+
+  @Param
+    bus = bus object to initialize
+    first_pin = bus LSB [PB0-PB15], PORTA pins are rejected
+    width = number of pins [1-16], first_pin + width must not go past PB15
+
+  @Returns
+    false if first_pin is not a PORTB pin or the bus runs past PB15
+*/
+bool ParallelBus_Attach( PARALLEL_BUS *_bus, uint8_t _first_pin, uint8_t _width );
+
+/**
+  @Description
+    Drives all pins of a parallel bus at once with a single LATB write
+
+  @Param
+    bus = bus from ParallelBus_Attach()
+    value = bus value, bit 0 on first_pin
+
+  @Returns
+    None
+*/
+void ParallelBus_Write( PARALLEL_BUS *_bus, uint16_t _value );
+
+/**
+  @Description
+    Returns the remappable pin (RPn) number of a GPIO pin for PPS
+    Only PORTB pins are remappable: RB0-RB15 => RP32-RP47
+
+  @Param
+    pin = [PB0-PB15]
+
+  @Returns
+    RPn number, 0 if the pin is not remappable
+*/
+uint8_t PPS_GetRP( uint8_t _pin );
+
+/**
+  @Description
+    Sets a remappable pin as digital input for a PPS input function
+
+  @Param
+    pin = [PB0-PB15]
+
+  @Returns
+    RPn number to be written to the peripheral input register, 0 if the pin is not remappable
+*/
+uint8_t PPS_SetInputPin( uint8_t _pin );
+
+/**
+  @Description
+    Sets a remappable pin as output and assigns a peripheral output function
+
+  @Param
+    pin = [PB0-PB15]
+    function = [PPS_OUT_NONE, PPS_OUT_SDO1, PPS_OUT_SCK1, ...]
+
+  @Returns
+    None
+*/
+void PPS_SetOutputPin( uint8_t _pin, uint8_t _function );
+
 #endif	/* _DSPIC33_CORE_H */
 
@@ -0,0 +1,199 @@
+/*
+ * File:            dspic33ck_cpuload.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for CPU load and per-interrupt utilization routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_cpuload.h"
+
+
+// *****************************************************************************
+// CPU Load Routines
+//
+// - every frame saves the nested time of the frame it preempted and starts
+//   its own from 0, on exit it charges elapsed - nested to its source and
+//   adds elapsed to the nested time of the preempted frame
+// - frames are opened and closed under DISI so a preempting handler never
+//   sees half an update
+// - a frame that spans a window boundary is charged to the window it closes in
+//
+// *****************************************************************************
+
+static CPULOAD_OBJ cpuload_obj;
+
+
+static uint16_t CPULoad_Share( uint32_t _cycles, uint32_t _unit ) {
+    uint32_t share;
+
+    share = _cycles / _unit;
+    return (share > CPULOAD_FULL) ? CPULOAD_FULL : (uint16_t) share;
+}
+
+
+void CPULoad_Initialize( uint16_t _window_ms ) {
+    uint8_t i;
+
+    if (!CCP9CON1Lbits.CCPON) {
+        SCCP9_Initialize();                                                     // free-running cycle counter
+    }
+
+    __builtin_disi(0x3FFF);
+    for (i = 0; i < CPULOAD_SOURCES; i++) {
+        cpuload_obj.busy[i] = 0;
+        cpuload_obj.load[i] = 0;
+        cpuload_obj.peak[i] = 0;
+    }
+    for (i = 0; i < CPULOAD_ISR_SOURCES; i++) {
+        cpuload_obj.longest[i] = 0;
+    }
+    for (i = 0; i < CPULOAD_HISTORY; i++) {
+        cpuload_obj.history[i] = 0;
+    }
+    cpuload_obj.history_index = 0;
+    cpuload_obj.peak_load = 0;
+    cpuload_obj.nested = 0;
+    cpuload_obj.tick = 0;
+    cpuload_obj.window_ms = (_window_ms > 0) ? _window_ms : 1;
+    cpuload_obj.window_start = SCCP9_Read();
+    __builtin_disi(0);
+}
+
+
+void CPULoad_Idle( void ) {
+    CPULOAD_FRAME frame;
+
+    CPULoad_IsrEnter(&frame);
+    Idle();                                                                     // wakes up on the next interrupt
+    CPULoad_IsrExit(&frame, CPULOAD_IDLE);
+}
+
+
+void CPULoad_IsrEnter( CPULOAD_FRAME *_frame ) {
+    __builtin_disi(0x3FFF);
+    _frame->start = SCCP9_Read();
+    _frame->nested = cpuload_obj.nested;
+    cpuload_obj.nested = 0;
+    __builtin_disi(0);
+}
+
+
+void CPULoad_IsrExit( CPULOAD_FRAME *_frame, uint8_t _source ) {
+    uint32_t elapsed;
+    uint32_t own;
+
+    __builtin_disi(0x3FFF);
+    elapsed = SCCP9_Read() - _frame->start;
+    own = elapsed - cpuload_obj.nested;
+    cpuload_obj.busy[_source] += own;
+    cpuload_obj.nested = _frame->nested + elapsed;
+    __builtin_disi(0);
+
+    if (_source < CPULOAD_ISR_SOURCES && own > cpuload_obj.longest[_source]) {
+        cpuload_obj.longest[_source] = (own > 0xFFFF) ? 0xFFFF : (uint16_t) own;    // only this level writes its own sources
+    }
+}
+
+
+void CPULoad_Tick( void ) {
+    uint32_t busy[CPULOAD_SOURCES];
+    uint32_t total;
+    uint32_t unit;
+    uint32_t now;
+    uint8_t i;
+
+    cpuload_obj.tick++;
+    if (cpuload_obj.tick < cpuload_obj.window_ms) {
+        return;
+    }
+    cpuload_obj.tick = 0;
+
+    __builtin_disi(0x3FFF);
+    now = SCCP9_Read();
+    for (i = 0; i < CPULOAD_SOURCES; i++) {
+        busy[i] = cpuload_obj.busy[i];
+        cpuload_obj.busy[i] = 0;
+    }
+    __builtin_disi(0);
+
+    total = now - cpuload_obj.window_start;
+    cpuload_obj.window_start = now;
+    unit = total / CPULOAD_FULL;
+    if (unit == 0) {
+        return;
+    }
+
+    busy[CPULOAD_MAIN] = total - busy[CPULOAD_IDLE];                            // whatever no frame accounted for
+    for (i = 0; i < CPULOAD_ISR_SOURCES; i++) {
+        busy[CPULOAD_MAIN] = (busy[CPULOAD_MAIN] > busy[i]) ? busy[CPULOAD_MAIN] - busy[i] : 0;
+    }
+
+    for (i = 0; i < CPULOAD_SOURCES; i++) {
+        cpuload_obj.load[i] = CPULoad_Share(busy[i], unit);
+        if (cpuload_obj.load[i] > cpuload_obj.peak[i]) {
+            cpuload_obj.peak[i] = cpuload_obj.load[i];
+        }
+    }
+    cpuload_obj.history[cpuload_obj.history_index] = CPULoad_Get();
+    if (cpuload_obj.history[cpuload_obj.history_index] > cpuload_obj.peak_load) {
+        cpuload_obj.peak_load = cpuload_obj.history[cpuload_obj.history_index];
+    }
+    cpuload_obj.history_index = (cpuload_obj.history_index + 1) % CPULOAD_HISTORY;
+}
+
+
+uint16_t CPULoad_Get( void ) {
+    return CPULOAD_FULL - cpuload_obj.load[CPULOAD_IDLE];
+}
+
+
+uint16_t CPULoad_GetAverage( void ) {
+    uint32_t sum;
+    uint8_t i;
+
+    sum = 0;
+    for (i = 0; i < CPULOAD_HISTORY; i++) {
+        sum += cpuload_obj.history[i];
+    }
+    return (uint16_t) (sum / CPULOAD_HISTORY);
+}
+
+
+uint16_t CPULoad_GetPeak( void ) {
+    return cpuload_obj.peak_load;
+}
+
+
+uint16_t CPULoad_GetSource( uint8_t _source ) {
+    return (_source < CPULOAD_SOURCES) ? cpuload_obj.load[_source] : 0;
+}
+
+
+uint16_t CPULoad_GetSourcePeak( uint8_t _source ) {
+    return (_source < CPULOAD_SOURCES) ? cpuload_obj.peak[_source] : 0;
+}
+
+
+uint16_t CPULoad_GetLongest( uint8_t _source ) {
+    return (_source < CPULOAD_ISR_SOURCES) ? cpuload_obj.longest[_source] : 0;
+}
+
+
+void CPULoad_ResetPeaks( void ) {
+    uint8_t i;
+
+    for (i = 0; i < CPULOAD_SOURCES; i++) {
+        cpuload_obj.peak[i] = 0;
+    }
+    for (i = 0; i < CPULOAD_ISR_SOURCES; i++) {
+        cpuload_obj.longest[i] = 0;
+    }
+    cpuload_obj.peak_load = 0;
+}
+
+
+/**
+ End of File
+*/
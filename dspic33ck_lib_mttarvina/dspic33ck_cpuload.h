@@ -0,0 +1,228 @@
+/*
+ * File:            dspic33ck_cpuload.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for CPU load and per-interrupt utilization routines
+ */
+
+
+#ifndef _DSPIC33CK_CPULOAD_H
+#define _DSPIC33CK_CPULOAD_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define CPULOAD_TIMER1                0x0   // sources, one per library interrupt
+#define CPULOAD_SCCP1                 0x1
+#define CPULOAD_SCCP2                 0x2
+#define CPULOAD_ADC                   0x3   // for application ADC handlers, the library ones are weak placeholders
+#define CPULOAD_PWMA                  0x4
+#define CPULOAD_CAPTURE               0x5
+#define CPULOAD_QEI1                  0x6
+#define CPULOAD_I2C1                  0x7
+#define CPULOAD_INPUT                 0x8
+#define CPULOAD_SPI1                  0x9
+#define CPULOAD_CRC                   0xA
+#define CPULOAD_DDS                   0xB
+#define CPULOAD_PWMFLT                0xC
+#define CPULOAD_ISR_SOURCES           13
+#define CPULOAD_IDLE                  0xD   // time spent in CPULoad_Idle()
+#define CPULOAD_MAIN                  0xE   // everything else: main loop work outside CPULoad_Idle()
+#define CPULOAD_SOURCES               15
+
+#define CPULOAD_FULL                  10000 // 100.00%
+#define CPULOAD_HISTORY               8     // windows in the sliding average
+#define CPULOAD_ISR_OVERHEAD          60    // cycles CPULOAD_ISR_ENTER()/EXIT() add to every instrumented handler, estimated
+
+
+// first statement of an ISR, after its local declarations
+#define CPULOAD_ISR_ENTER()           CPULOAD_FRAME cpuload_frame; if (CPULOAD_EN) { CPULoad_IsrEnter(&cpuload_frame); }
+// last statement of an ISR
+#define CPULOAD_ISR_EXIT(source)      if (CPULOAD_EN) { CPULoad_IsrExit(&cpuload_frame, (source)); }
+
+
+typedef struct _CPULOAD_FRAME_STRUCT {
+    uint32_t                start;                                              // SCCP9 count at entry
+    uint32_t                nested;                                             // nested time of the preempted frame
+} CPULOAD_FRAME;
+
+
+typedef struct _CPULOAD_OBJ_STRUCT {
+    volatile uint32_t       busy[CPULOAD_SOURCES];                              // cycles in the open window
+    volatile uint32_t       nested;                                             // cycles of handlers nested in the running frame
+    uint32_t                window_start;
+    uint16_t                window_ms;
+    uint16_t                tick;
+    volatile uint16_t       load[CPULOAD_SOURCES];                              // last window, CPULOAD_FULL = 100%
+    volatile uint16_t       peak[CPULOAD_SOURCES];
+    volatile uint16_t       peak_load;                                          // highest total load of any window
+    volatile uint16_t       longest[CPULOAD_ISR_SOURCES];                       // cycles of the longest single run, less nested handlers
+    uint16_t                history[CPULOAD_HISTORY];                           // total load of the last windows
+    uint8_t                 history_index;
+} CPULOAD_OBJ;
+
+
+// *****************************************************************************
+// CPU Load Function Call Definitions
+// SCCP9 timestamps every instrumented interrupt on entry and exit, time spent
+// in nested interrupts is charged to the nested handler only
+// The window closes on the SCCP1 1ms tick, loads are in 0.01% units
+// Each instrumented interrupt costs about CPULOAD_ISR_OVERHEAD cycles of
+// measurement overhead, charged to its own source
+// *****************************************************************************
+
+/**
+  @Description
+    Starts load measurement, starts SCCP9 if it is not running yet
+    Needs CPULOAD_EN and SCCP1_EN
+
+  @Param
+    _window_ms = length of one measurement window in ms, e.g. 100
+
+  @Returns
+    None
+*/
+void CPULoad_Initialize( uint16_t _window_ms );
+
+/**
+  @Description
+    Waits in Idle mode until the next interrupt, the time spent here is
+    counted as idle. Call it from the main loop whenever there is nothing to do
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void CPULoad_Idle( void );
+
+/**
+  @Description
+    Opens a measurement frame, used through CPULOAD_ISR_ENTER()
+
+  @Param
+    _frame = frame local to the interrupt handler
+
+  @Returns
+    None
+*/
+void CPULoad_IsrEnter( CPULOAD_FRAME *_frame );
+
+/**
+  @Description
+    Closes a measurement frame and charges its time, less nested handlers,
+    to a source, used through CPULOAD_ISR_EXIT()
+
+  @Param
+    _frame = frame opened by CPULoad_IsrEnter()
+    _source = [CPULOAD_TIMER1, CPULOAD_SCCP1, ... CPULOAD_PWMFLT]
+
+  @Returns
+    None
+*/
+void CPULoad_IsrExit( CPULOAD_FRAME *_frame, uint8_t _source );
+
+/**
+  @Description
+    Closes the window every _window_ms ticks, called from the SCCP1 1ms tick
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void CPULoad_Tick( void );
+
+/**
+  @Description
+    Returns the total load of the last window, 100% minus idle
+
+  @Param
+    None.
+
+  @Returns
+    load [0 - CPULOAD_FULL]
+*/
+uint16_t CPULoad_Get( void );
+
+/**
+  @Description
+    Returns the total load averaged over the last CPULOAD_HISTORY windows
+
+  @Param
+    None.
+
+  @Returns
+    load [0 - CPULOAD_FULL]
+*/
+uint16_t CPULoad_GetAverage( void );
+
+/**
+  @Description
+    Returns the highest total load of any window since the last reset of the peaks
+
+  @Param
+    None.
+
+  @Returns
+    load [0 - CPULOAD_FULL]
+*/
+uint16_t CPULoad_GetPeak( void );
+
+/**
+  @Description
+    Returns the share of the last window used by one source
+
+  @Param
+    _source = [CPULOAD_TIMER1, ... CPULOAD_PWMFLT, CPULOAD_IDLE, CPULOAD_MAIN]
+
+  @Returns
+    load [0 - CPULOAD_FULL]
+*/
+uint16_t CPULoad_GetSource( uint8_t _source );
+
+/**
+  @Description
+    Returns the highest share of any window used by one source
+
+  @Param
+    _source = [CPULOAD_TIMER1, ... CPULOAD_PWMFLT, CPULOAD_IDLE, CPULOAD_MAIN]
+
+  @Returns
+    load [0 - CPULOAD_FULL]
+*/
+uint16_t CPULoad_GetSourcePeak( uint8_t _source );
+
+/**
+  @Description
+    Returns the longest single run of one interrupt source since the last
+    reset of the peaks, less the handlers nested in it. Includes part of the
+    measurement overhead, so it is slightly above the bare handler time.
+    Used by INT_GetWorstCaseLatency() in place of a lower estimate
+
+  @Param
+    _source = [CPULOAD_TIMER1, CPULOAD_SCCP1, ... CPULOAD_PWMFLT]
+
+  @Returns
+    instruction cycles, saturates at 0xFFFF, 0 if the source has not run
+*/
+uint16_t CPULoad_GetLongest( uint8_t _source );
+
+/**
+  @Description
+    Clears all peaks and longest runs
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void CPULoad_ResetPeaks( void );
+
+
+#endif //_DSPIC33CK_CPULOAD_H
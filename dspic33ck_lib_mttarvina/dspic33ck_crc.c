@@ -0,0 +1,270 @@
+/*
+ * File:            dspic33ck_crc.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for CRC and telemetry framing routines
+ */
+
+
+#include "dspic33ck_crc.h"
+
+
+#define CRC16_POLY                    0x1021
+#define CRC16_INIT                    0xFFFF
+#define CRC32_POLY                    0x04C11DB7UL
+#define CRC32_INIT                    0xFFFFFFFFUL
+
+
+// *****************************************************************************
+// CRC Routines
+//
+// - hardware: CRC interrupt on FIFO empty refills the FIFO,
+//   the last interrupt on shift complete reads the result
+// - software: bitwise, same polynomial, seed and bit order
+//
+// *****************************************************************************
+
+static CRC_OBJ crc_obj;
+
+
+uint32_t CRC_ComputeSoftware( const uint16_t *_data, uint16_t _words, uint8_t _type ) {
+    uint32_t crc;
+    uint32_t poly;
+    uint32_t top;
+    uint32_t mask;
+    uint16_t word;
+    uint8_t bit;
+
+    if (_type == CRC_32) {
+        crc = CRC32_INIT;
+        poly = CRC32_POLY;
+        top = 0x80000000UL;
+        mask = 0xFFFFFFFFUL;
+    }
+    else {
+        crc = CRC16_INIT;
+        poly = CRC16_POLY;
+        top = 0x8000;
+        mask = 0xFFFF;
+    }
+
+    while (_words--) {
+        word = *_data++;
+        for (bit = 0; bit < 16; bit++) {                                        // MSB first
+            if (((crc & top) != 0) != ((word & 0x8000) != 0)) {
+                crc = ((crc << 1) ^ poly) & mask;
+            }
+            else {
+                crc = (crc << 1) & mask;
+            }
+            word <<= 1;
+        }
+    }
+    return crc;
+}
+
+
+#if CRC_USE_HARDWARE
+
+static void CRC_Feed( void ) {
+    while (crc_obj.remaining && !CRCCONLbits.CRCFUL) {
+        CRCDATL = *crc_obj.data++;
+        crc_obj.remaining--;
+    }
+    if (crc_obj.remaining == 0) {
+        CRCCONLbits.CRCISEL = 0;                                                // next interrupt when the last word is shifted
+    }
+}
+
+
+bool CRC_Start( const uint16_t *_data, uint16_t _words, uint8_t _type, void (*_callback)( uint32_t _crc ) ) {
+
+    if (crc_obj.busy) {
+        return false;
+    }
+    if (_words == 0) {
+        crc_obj.result = (_type == CRC_32) ? CRC32_INIT : CRC16_INIT;
+        if (_callback) {
+            _callback(crc_obj.result);
+        }
+        return true;
+    }
+
+    PMD_ModuleEnable(PMD_CRC);                                                  // power up CRC before accessing its registers
+
+    crc_obj.busy = true;
+    crc_obj.data = _data;
+    crc_obj.remaining = _words;
+    crc_obj.type = _type;
+    crc_obj.callback = _callback;
+
+    CRCCONL = 0x0000;                                                           // CRCEN disabled; LENDIAN MSB first; CRCISEL shift complete;
+    if (_type == CRC_32) {
+        CRCCONH = 0x0F1F;                                                       // DWIDTH 16bit; PLEN 32bit;
+        CRCXORL = (uint16_t) CRC32_POLY;
+        CRCXORH = (uint16_t) (CRC32_POLY >> 16);
+        CRCWDATL = (uint16_t) CRC32_INIT;
+        CRCWDATH = (uint16_t) (CRC32_INIT >> 16);
+    }
+    else {
+        CRCCONH = 0x0F0F;                                                       // DWIDTH 16bit; PLEN 16bit;
+        CRCXORL = CRC16_POLY;
+        CRCXORH = 0x0000;
+        CRCWDATL = CRC16_INIT;
+        CRCWDATH = 0x0000;
+    }
+
+    //    CRCI: CRC Generator
+    //    Priority: CRC_IPL
+    _CRCIP = CRC_IPL;
+
+    CRCCONLbits.CRCEN = true;
+    CRCCONLbits.CRCISEL = 1;                                                    // interrupt when the FIFO runs empty
+    CRC_Feed();
+    _CRCIF = false;
+    _CRCIE = true;
+    CRCCONLbits.CRCGO = true;
+
+    return true;
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CRCInterrupt ( void ) {
+    CPULOAD_ISR_ENTER();
+    _CRCIF = false;
+
+    if (crc_obj.remaining) {
+        CRC_Feed();
+        CPULOAD_ISR_EXIT(CPULOAD_CRC);
+        return;
+    }
+    if (!CRCCONLbits.CRCMPT || CRCCONLbits.CRCISEL) {
+        CRCCONLbits.CRCISEL = 0;
+        CPULOAD_ISR_EXIT(CPULOAD_CRC);
+        return;                                                                 // last word still shifting
+    }
+
+    CRCCONLbits.CRCGO = false;
+    _CRCIE = false;
+    if (crc_obj.type == CRC_32) {
+        crc_obj.result = ((uint32_t) CRCWDATH << 16) | CRCWDATL;
+    }
+    else {
+        crc_obj.result = CRCWDATL;
+    }
+    CRCCONLbits.CRCEN = false;
+    crc_obj.busy = false;
+
+    if (crc_obj.callback) {
+        crc_obj.callback(crc_obj.result);
+    }
+    CPULOAD_ISR_EXIT(CPULOAD_CRC);
+}
+
+#else
+
+bool CRC_Start( const uint16_t *_data, uint16_t _words, uint8_t _type, void (*_callback)( uint32_t _crc ) ) {
+
+    if (crc_obj.busy) {
+        return false;
+    }
+    crc_obj.result = CRC_ComputeSoftware(_data, _words, _type);
+    if (_callback) {
+        _callback(crc_obj.result);
+    }
+    return true;
+}
+
+#endif
+
+
+bool CRC_IsBusy( void ) {
+    return crc_obj.busy;
+}
+
+
+uint32_t CRC_GetResult( void ) {
+    return crc_obj.result;
+}
+
+
+uint32_t CRC_Compute( const uint16_t *_data, uint16_t _words, uint8_t _type ) {
+    while (!CRC_Start(_data, _words, _type, 0));
+    while (CRC_IsBusy());
+    return CRC_GetResult();
+}
+
+
+
+
+// *****************************************************************************
+// Frame Routines
+//
+// - outgoing frames get their CRC from the engine while the CPU moves on
+// - incoming frames are checked with a blocking CRC, commands are short
+//
+// *****************************************************************************
+
+static uint16_t *frame_tx;
+static uint16_t frame_tx_words;
+static uint8_t frame_sequence;
+static volatile bool frame_ready;
+
+
+static void Frame_AppendCRC( uint32_t _crc ) {
+    if (FRAME_CRC == CRC_32) {
+        frame_tx[frame_tx_words] = (uint16_t) (_crc >> 16);
+        frame_tx[frame_tx_words + 1] = (uint16_t) _crc;
+    }
+    else {
+        frame_tx[frame_tx_words] = (uint16_t) _crc;
+    }
+    frame_ready = true;
+}
+
+
+bool Frame_Send( uint16_t *_frame, uint8_t _type, uint16_t _payload_words ) {
+
+    if (CRC_IsBusy()) {
+        return false;
+    }
+    _frame[0] = FRAME_SYNC;
+    _frame[1] = ((uint16_t) _type << 8) | frame_sequence++;
+    _frame[2] = _payload_words;
+
+    frame_tx = _frame;
+    frame_tx_words = FRAME_HEADER_WORDS + _payload_words;
+    frame_ready = false;
+
+    return CRC_Start(_frame, frame_tx_words, FRAME_CRC, Frame_AppendCRC);
+}
+
+
+bool Frame_IsReady( void ) {
+    return frame_ready;
+}
+
+
+bool Frame_Check( const uint16_t *_frame, uint16_t _words ) {
+    uint16_t length;
+    uint32_t crc;
+
+    if (_words < FRAME_WORDS(0) || _frame[0] != FRAME_SYNC) {
+        return false;
+    }
+    length = FRAME_HEADER_WORDS + _frame[2];
+    if (_words != length + FRAME_CRC_WORDS) {
+        return false;
+    }
+
+    crc = CRC_Compute(_frame, length, FRAME_CRC);
+    if (FRAME_CRC == CRC_32) {
+        return (_frame[length] == (uint16_t) (crc >> 16)) && (_frame[length + 1] == (uint16_t) crc);
+    }
+    return _frame[length] == (uint16_t) crc;
+}
+
+
+/**
+ End of File
+*/
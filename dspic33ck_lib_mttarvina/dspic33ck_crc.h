@@ -0,0 +1,168 @@
+/*
+ * File:            dspic33ck_crc.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for CRC and telemetry framing routines
+ *                  Builds without xc.h for host tests, using the software CRC
+ */
+
+
+#ifndef _DSPIC33CK_CRC_H
+#define _DSPIC33CK_CRC_H
+
+
+#ifdef __XC16__
+#include <xc.h>
+#include "dspic33ck_core.h"
+#define CRC_USE_HARDWARE              true  // false: software CRC, same results
+#else
+#include <stdint.h>
+#include <stdbool.h>
+#define CRC_USE_HARDWARE              false
+#endif
+
+
+#define CRC_16                        0x0   // CRC-16/CCITT-FALSE: poly 0x1021, init 0xFFFF, MSB first, no final xor
+#define CRC_32                        0x1   // CRC-32/MPEG-2: poly 0x04C11DB7, init 0xFFFFFFFF, MSB first, no final xor
+
+#define FRAME_SYNC                    0xA55A
+#define FRAME_HEADER_WORDS            3     // sync, type/sequence, payload length
+#define FRAME_CRC                     CRC_32
+#define FRAME_CRC_WORDS               ((FRAME_CRC == CRC_32) ? 2 : 1)
+#define FRAME_WORDS(payload)          (FRAME_HEADER_WORDS + (payload) + FRAME_CRC_WORDS)
+
+
+typedef struct _CRC_OBJ_STRUCT {
+    const uint16_t          *data;
+    volatile uint16_t       remaining;
+    volatile bool           busy;
+    volatile uint32_t       result;
+    uint8_t                 type;
+    void                    (*callback)( uint32_t _crc );
+} CRC_OBJ;
+
+
+// *****************************************************************************
+// CRC Function Call Definitions
+// Data is processed as 16bit words, most significant bit first
+// *****************************************************************************
+
+/**
+  @Description
+    Starts a CRC over a block of words and returns immediately
+    With CRC_USE_HARDWARE the CRC interrupt keeps the engine FIFO filled,
+    otherwise the CRC is computed in software before returning
+
+  @Param
+    _data = words to process, must stay valid until done
+    _words = number of words
+    _type = [CRC_16, CRC_32]
+    _callback = called with the result when done (from the CRC interrupt), may be NULL
+
+  @Returns
+    false if a CRC is still in progress
+*/
+bool CRC_Start( const uint16_t *_data, uint16_t _words, uint8_t _type, void (*_callback)( uint32_t _crc ) );
+
+/**
+  @Description
+    Checks if a CRC started by CRC_Start() is in progress
+
+  @Param
+    None.
+
+  @Returns
+    true if busy
+*/
+bool CRC_IsBusy( void );
+
+/**
+  @Description
+    Returns the result of the last CRC
+
+  @Param
+    None.
+
+  @Returns
+    CRC value
+*/
+uint32_t CRC_GetResult( void );
+
+/**
+  @Description
+    Computes a CRC and waits for the result
+
+  @Param
+    _data = words to process
+    _words = number of words
+    _type = [CRC_16, CRC_32]
+
+  @Returns
+    CRC value
+*/
+uint32_t CRC_Compute( const uint16_t *_data, uint16_t _words, uint8_t _type );
+
+/**
+  @Description
+    Computes a CRC in software, bit-exact with the hardware engine
+    Reference for host tests and fallback when the CRC module is not used
+
+  @Param
+    _data = words to process
+    _words = number of words
+    _type = [CRC_16, CRC_32]
+
+  @Returns
+    CRC value
+*/
+uint32_t CRC_ComputeSoftware( const uint16_t *_data, uint16_t _words, uint8_t _type );
+
+
+// *****************************************************************************
+// Frame Function Call Definitions
+// Frame = [FRAME_SYNC][type << 8 | sequence][payload words][payload...][CRC]
+// *****************************************************************************
+
+/**
+  @Description
+    Fills in the header of an outgoing frame and starts the CRC of header
+    and payload. The CRC is appended when done, check with Frame_IsReady()
+    The payload must already be at _frame[FRAME_HEADER_WORDS]
+
+  @Param
+    _frame = buffer of FRAME_WORDS(_payload_words) words
+    _type = frame type
+    _payload_words = number of payload words
+
+  @Returns
+    false if a CRC is still in progress
+*/
+bool Frame_Send( uint16_t *_frame, uint8_t _type, uint16_t _payload_words );
+
+/**
+  @Description
+    Checks if the frame passed to Frame_Send() has its CRC appended
+
+  @Param
+    None.
+
+  @Returns
+    true if ready to be transmitted
+*/
+bool Frame_IsReady( void );
+
+/**
+  @Description
+    Validates an incoming frame: sync word, length and CRC
+
+  @Param
+    _frame = received words
+    _words = number of words received
+
+  @Returns
+    true if valid
+*/
+bool Frame_Check( const uint16_t *_frame, uint16_t _words );
+
+
+#endif //_DSPIC33CK_CRC_H
@@ -0,0 +1,200 @@
+/*
+ * File:            dspic33ck_dds.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for direct digital synthesis (DDS) routines on DAC1
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_dds.h"
+
+
+// *****************************************************************************
+// DDS Routines
+//
+// - the sample computed in the previous interrupt is written first, so the
+//   DAC update time does not depend on the table lookup
+// - const tables are placed in program memory and read through PSV
+//
+// *****************************************************************************
+
+static const int16_t dds_sine[DDS_TABLE_SIZE] = {
+        0,    50,   100,   151,   201,   251,   300,   350,
+      399,   449,   497,   546,   594,   642,   690,   737,
+      783,   830,   875,   920,   965,  1009,  1052,  1095,
+     1137,  1179,  1219,  1259,  1299,  1337,  1375,  1411,
+     1447,  1483,  1517,  1550,  1582,  1614,  1644,  1674,
+     1702,  1729,  1756,  1781,  1805,  1828,  1850,  1871,
+     1891,  1910,  1927,  1944,  1959,  1973,  1986,  1997,
+     2008,  2017,  2025,  2032,  2037,  2041,  2045,  2046,
+     2047,  2046,  2045,  2041,  2037,  2032,  2025,  2017,
+     2008,  1997,  1986,  1973,  1959,  1944,  1927,  1910,
+     1891,  1871,  1850,  1828,  1805,  1781,  1756,  1729,
+     1702,  1674,  1644,  1614,  1582,  1550,  1517,  1483,
+     1447,  1411,  1375,  1337,  1299,  1259,  1219,  1179,
+     1137,  1095,  1052,  1009,   965,   920,   875,   830,
+      783,   737,   690,   642,   594,   546,   497,   449,
+      399,   350,   300,   251,   201,   151,   100,    50,
+        0,   -50,  -100,  -151,  -201,  -251,  -300,  -350,
+     -399,  -449,  -497,  -546,  -594,  -642,  -690,  -737,
+     -783,  -830,  -875,  -920,  -965, -1009, -1052, -1095,
+    -1137, -1179, -1219, -1259, -1299, -1337, -1375, -1411,
+    -1447, -1483, -1517, -1550, -1582, -1614, -1644, -1674,
+    -1702, -1729, -1756, -1781, -1805, -1828, -1850, -1871,
+    -1891, -1910, -1927, -1944, -1959, -1973, -1986, -1997,
+    -2008, -2017, -2025, -2032, -2037, -2041, -2045, -2046,
+    -2047, -2046, -2045, -2041, -2037, -2032, -2025, -2017,
+    -2008, -1997, -1986, -1973, -1959, -1944, -1927, -1910,
+    -1891, -1871, -1850, -1828, -1805, -1781, -1756, -1729,
+    -1702, -1674, -1644, -1614, -1582, -1550, -1517, -1483,
+    -1447, -1411, -1375, -1337, -1299, -1259, -1219, -1179,
+    -1137, -1095, -1052, -1009,  -965,  -920,  -875,  -830,
+     -783,  -737,  -690,  -642,  -594,  -546,  -497,  -449,
+     -399,  -350,  -300,  -251,  -201,  -151,  -100,   -50
+};
+
+static DDS_OBJ dds_obj;
+
+
+static uint16_t DDS_NextSample( void ) {
+    int16_t value;
+
+    value = dds_obj.table[(dds_obj.phase + dds_obj.phase_offset) >> (32 - DDS_TABLE_BITS)];
+    value = (int16_t) dds_obj.offset + (int16_t) (__builtin_mulss(value, dds_obj.amplitude) >> 15);
+
+    if (value < 0) {
+        return 0;
+    }
+    if (value > 0x0FFF) {
+        return 0x0FFF;
+    }
+    return (uint16_t) value;
+}
+
+
+bool DDS_Initialize( uint32_t _sample_rate ) {
+    uint32_t period;
+
+    if (_sample_rate == 0) {
+        return false;
+    }
+    period = CLOCK_InstructionFrequencyGet() / _sample_rate;                    // 1 sample per period
+    if (period < DDS_MIN_PERIOD) {
+        return false;                                                           // the interrupt could not keep up
+    }
+
+    DAC_Enable();
+
+    dds_obj.table = dds_sine;
+    dds_obj.phase = 0;
+    dds_obj.tuning_word = 0;
+    dds_obj.phase_offset = 0;
+    dds_obj.amplitude = DDS_FULL_AMPLITUDE;
+    dds_obj.offset = DDS_MIDSCALE;
+    dds_obj.sample_rate = _sample_rate;
+    dds_obj.next_sample = DDS_NextSample();
+
+    PMD_ModuleEnable(PMD_CCP6);                                                 // power up SCCP6 before accessing its registers
+
+    //    CCT6I: CCP6 Timer Event
+    //    Priority: DDS_IPL, above the other drivers to keep the sample clock free of jitter
+    _CCT6IP = DDS_IPL;
+
+    // CCPON disabled; MOD 16-Bit/32-Bit Timer;
+    // CCSEL disabled; CCPSIDL disabled; T32 32 Bit;
+    // CCPSLP disabled; TMRPS 1:1; CLKSEL FOSC/2; TMRSYNC disabled;
+
+    CCP6CON1L = (0x20 & 0x7FFF);                                                //Disabling CCPON bit, 32 bit period for rates below Fcy/65536
+    CCP6CON1H = 0x00;                                                           //OPS Each Time Base Period Match; SYNC None; OPSSRC Timer Interrupt Event;
+    CCP6CON2L = 0x00;
+    CCP6CON2H = 0x00;
+    CCP6CON3H = 0x00;
+    CCP6STATL = 0x00;
+    CCP6TMRL = 0x00;
+    CCP6TMRH = 0x00;
+    CCP6PRL = (uint16_t) (period - 1);
+    CCP6PRH = (uint16_t) ((period - 1) >> 16);
+
+    _CCP6IE = false;
+    _CCT6IF = false;
+
+    return true;
+}
+
+
+void DDS_Start( void ) {
+    _CCT6IE = true;
+    CCP6CON1Lbits.CCPON = true;
+}
+
+
+void DDS_Stop( void ) {
+    CCP6CON1Lbits.CCPON = false;
+    _CCT6IE = false;
+}
+
+
+void DDS_SetFrequency( uint32_t _freq_hz ) {
+    if (dds_obj.sample_rate == 0) {
+        return;                                                                 // DDS_Initialize() failed or was not called
+    }
+    DDS_SetTuningWord((uint32_t) (((uint64_t) _freq_hz << 32) / dds_obj.sample_rate));
+}
+
+
+void DDS_SetTuningWord( uint32_t _tuning_word ) {
+    bool enabled;
+
+    enabled = _CCT6IE;
+    _CCT6IE = false;                                                            // 32bit value is read by the interrupt
+    dds_obj.tuning_word = _tuning_word;
+    _CCT6IE = enabled;
+}
+
+
+void DDS_SetAmplitude( int16_t _amplitude, uint16_t _offset ) {
+    bool enabled;
+
+    enabled = _CCT6IE;
+    _CCT6IE = false;
+    dds_obj.amplitude = _amplitude;
+    dds_obj.offset = _offset;
+    _CCT6IE = enabled;
+}
+
+
+void DDS_SetPhase( uint16_t _phase ) {
+    bool enabled;
+
+    enabled = _CCT6IE;
+    _CCT6IE = false;
+    dds_obj.phase_offset = (uint32_t) _phase << 16;
+    _CCT6IE = enabled;
+}
+
+
+void DDS_SetTable( const int16_t *_table ) {
+    bool enabled;
+
+    enabled = _CCT6IE;
+    _CCT6IE = false;
+    dds_obj.table = _table ? _table : dds_sine;
+    _CCT6IE = enabled;
+}
+
+
+void __attribute__ ( ( interrupt, auto_psv ISR_CONTEXT ) ) _CCT6Interrupt ( void ) {
+    CPULOAD_ISR_ENTER();
+    DAC1DATH = dds_obj.next_sample;
+    _CCT6IF = false;
+
+    dds_obj.phase += dds_obj.tuning_word;
+    dds_obj.next_sample = DDS_NextSample();
+    CPULOAD_ISR_EXIT(CPULOAD_DDS);
+}
+
+
+/**
+ End of File
+*/
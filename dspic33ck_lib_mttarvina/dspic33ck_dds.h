@@ -0,0 +1,144 @@
+/*
+ * File:            dspic33ck_dds.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for direct digital synthesis (DDS) routines on DAC1
+ */
+
+
+#ifndef _DSPIC33CK_DDS_H
+#define _DSPIC33CK_DDS_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define DDS_TABLE_BITS                8
+#define DDS_TABLE_SIZE                256   // entries per waveform period, 2^DDS_TABLE_BITS
+#define DDS_MIDSCALE                  2048  // DAC value of a table entry of 0
+#define DDS_FULL_AMPLITUDE            0x7FFF  // Q15 amplitude of 1.0
+#define DDS_MIN_PERIOD                (2 * (INT_ENTRY_CYCLES + DDS_ISR_CYCLES)) // instruction cycles per sample, leaves half of the CPU to the rest
+
+
+typedef struct _DDS_OBJ_STRUCT {
+    const int16_t           *table;                                             // DDS_TABLE_SIZE signed entries, -2047 to 2047 at full scale
+    volatile uint32_t       phase;                                              // phase accumulator, 2^32 = one waveform period
+    volatile uint32_t       tuning_word;                                        // added to phase every sample
+    volatile uint32_t       phase_offset;
+    volatile int16_t        amplitude;                                          // Q15
+    volatile uint16_t       offset;                                             // DAC value of the waveform center
+    volatile uint16_t       next_sample;                                        // written to the DAC at the next SCCP6 period
+    uint32_t                sample_rate;
+} DDS_OBJ;
+
+
+// *****************************************************************************
+// DDS Function Call Definitions
+// SCCP6 period = 1 sample, the CCT6 interrupt writes DAC1DATH
+// Output frequency = tuning_word * sample_rate / 2^32
+// *****************************************************************************
+
+/**
+  @Description
+    Sets up SCCP6 as the DDS sample clock and enables the DAC output at RA3
+    The sine table is selected, amplitude = full scale, frequency = 0
+
+  @Param
+    _sample_rate = DAC update rate in Sa/s, e.g. 500000
+                   [1 - Fcy / DDS_MIN_PERIOD], SCCP6 runs as a 32 bit timer
+                   so low rates need no prescaler
+
+  @Returns
+    false if _sample_rate is 0 or too high, SCCP6 and the DAC are left untouched
+*/
+bool DDS_Initialize( uint32_t _sample_rate );
+
+/**
+  @Description
+    Start DDS output
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void DDS_Start( void );
+
+/**
+  @Description
+    Stop DDS output, the DAC holds the last sample
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void DDS_Stop( void );
+
+/**
+  @Description
+    Sets the output frequency
+
+  @Param
+    _freq_hz = output frequency in Hz, below sample_rate / 2
+
+  @Returns
+    None
+*/
+void DDS_SetFrequency( uint32_t _freq_hz );
+
+/**
+  @Description
+    Sets the phase increment per sample directly, for sub-Hz resolution
+
+  @Param
+    _tuning_word = 2^32 * frequency / sample_rate
+
+  @Returns
+    None
+*/
+void DDS_SetTuningWord( uint32_t _tuning_word );
+
+/**
+  @Description
+    Sets the waveform amplitude and center
+
+  @Param
+    _amplitude = Q15 scale of the table, DDS_FULL_AMPLITUDE = 1.0
+    _offset = DAC value of the waveform center, DDS_MIDSCALE for a centered output
+
+  @Returns
+    None
+*/
+void DDS_SetAmplitude( int16_t _amplitude, uint16_t _offset );
+
+/**
+  @Description
+    Shifts the output phase
+
+  @Param
+    _phase = [0 - 65535] which translates to 0 - 360 degrees
+
+  @Returns
+    None
+*/
+void DDS_SetPhase( uint16_t _phase );
+
+/**
+  @Description
+    Selects the waveform table, e.g. an arbitrary waveform in program memory
+
+  @Param
+    _table = DDS_TABLE_SIZE signed entries, -2047 to 2047 at full scale,
+             NULL selects the built-in sine table
+
+  @Returns
+    None
+*/
+void DDS_SetTable( const int16_t *_table );
+
+
+#endif //_DSPIC33CK_DDS_H
@@ -0,0 +1,135 @@
+/*
+ * File:            dspic33ck_dmt.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for Dead Man Timer (DMT) control loop monitor routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_dmt.h"
+
+
+// *****************************************************************************
+// DMT Routines
+//
+// - the DMT counts instruction fetches from the last clear, a clear is
+//   STEP1 = 0x40 in DMTPRECLR followed by STEP2 = 0x08 in DMTCLR
+// - reaching the timeout, or clearing before the window opens, raises a DMT
+//   event which the device reports as a soft trap
+// - the trap handler saves a record in persistent RAM and resets the device
+//
+// *****************************************************************************
+
+static DMT_OBJ dmt_obj;
+static DMT_DIAG dmt_diag __attribute__ ( ( persistent ) );                      // not initialized by the startup code
+
+
+static uint32_t DMT_ReadCount( void ) {
+    uint16_t high;
+    uint16_t low;
+
+    do {
+        high = DMTCNTH;
+        low = DMTCNTL;
+    } while (high != DMTCNTH);                                                  // low word rolled over between the reads
+    return ((uint32_t) high << 16) | low;
+}
+
+
+void DMT_Initialize( uint32_t _warn_margin, void (*_callback)( uint32_t _margin ) ) {
+
+    if (!DMT_EN) {
+        return;
+    }
+
+    if (RCONbits.POR || dmt_diag.magic != DMT_DIAG_MAGIC) {
+        dmt_diag.magic = DMT_DIAG_MAGIC;                                        // RAM content is random after power-on
+        dmt_diag.resets = 0;
+        dmt_diag.reason = DMT_TRAP_NONE;
+        RCONbits.POR = false;                                                   // later trap resets keep the record
+    }
+
+    PMD_ModuleEnable(PMD_DMT);                                                  // power up DMT before accessing its registers
+
+    dmt_obj.timeout = ((uint32_t) DMTPSCNTH << 16) | DMTPSCNTL;
+    dmt_obj.window = ((uint32_t) DMTPSINTVH << 16) | DMTPSINTVL;
+    dmt_obj.warn_margin = _warn_margin;
+    dmt_obj.last_margin = dmt_obj.timeout;
+    dmt_obj.min_margin = dmt_obj.timeout;
+    dmt_obj.warnings = 0;
+    dmt_obj.callback = _callback;
+
+    DMTCONbits.ON = true;                                                       // cannot be turned off again by software
+}
+
+
+void DMT_Clear( void ) {
+    uint32_t count;
+    uint32_t margin;
+
+    count = DMT_ReadCount();
+    DMTPRECLRbits.STEP1 = 0x40;
+    DMTCLRbits.STEP2 = 0x08;
+
+    margin = (count < dmt_obj.timeout) ? dmt_obj.timeout - count : 0;
+    dmt_obj.last_margin = margin;
+    if (margin < dmt_obj.min_margin) {
+        dmt_obj.min_margin = margin;
+    }
+    if (margin < dmt_obj.warn_margin) {
+        dmt_obj.warnings++;
+        if (dmt_obj.callback) {
+            dmt_obj.callback(margin);
+        }
+    }
+}
+
+
+uint32_t DMT_GetMargin( void ) {
+    return dmt_obj.last_margin;
+}
+
+
+uint32_t DMT_GetMinMargin( void ) {
+    return dmt_obj.min_margin;
+}
+
+
+uint16_t DMT_GetWarnings( void ) {
+    return dmt_obj.warnings;
+}
+
+
+uint32_t DMT_GetTimeout( void ) {
+    return dmt_obj.timeout;
+}
+
+
+bool DMT_GetDiagnostic( DMT_DIAG *_diag ) {
+    *_diag = dmt_diag;
+    return (dmt_diag.magic == DMT_DIAG_MAGIC) && (dmt_diag.resets > 0);
+}
+
+
+#if DMT_EN
+void __attribute__ ( ( interrupt, no_auto_psv ) ) _SoftTrapError ( void ) {
+    dmt_diag.magic = DMT_DIAG_MAGIC;
+    dmt_diag.resets++;
+    dmt_diag.reason = DMTSTATbits.DMTEVENT ? DMT_TRAP_EVENT : DMT_TRAP_OTHER;
+    dmt_diag.status = DMTSTAT;
+    dmt_diag.intcon3 = INTCON3;
+    dmt_diag.count = DMT_ReadCount();
+    dmt_diag.min_margin = dmt_obj.min_margin;
+
+    if (dmt_obj.callback) {
+        dmt_obj.callback(0);                                                    // last chance to put the outputs in a safe state
+    }
+    __asm__ volatile ("reset");
+}
+#endif
+
+
+/**
+ End of File
+*/
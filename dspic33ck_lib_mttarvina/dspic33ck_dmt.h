@@ -0,0 +1,142 @@
+/*
+ * File:            dspic33ck_dmt.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for Dead Man Timer (DMT) control loop monitor routines
+ */
+
+
+#ifndef _DSPIC33CK_DMT_H
+#define _DSPIC33CK_DMT_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define DMT_DIAG_MAGIC                0xD317    // marks a valid diagnostic record in persistent RAM
+#define DMT_TRAP_NONE                 0x0
+#define DMT_TRAP_EVENT                0x1       // loop ran past the timeout or cleared before the window opened
+#define DMT_TRAP_OTHER                0x2       // any other soft trap, see intcon3
+
+
+typedef struct _DMT_DIAG_STRUCT {
+    uint16_t                magic;                                              // DMT_DIAG_MAGIC once the record is valid
+    uint16_t                resets;                                             // trap resets since power-on
+    uint8_t                 reason;                                             // last trap [DMT_TRAP_EVENT, DMT_TRAP_OTHER]
+    uint16_t                status;                                             // DMTSTAT at the last trap
+    uint16_t                intcon3;                                            // INTCON3 at the last trap
+    uint32_t                count;                                              // DMT count at the last trap
+    uint32_t                min_margin;                                         // smallest margin seen before the last trap
+} DMT_DIAG;
+
+
+typedef struct _DMT_OBJ_STRUCT {
+    uint32_t                timeout;                                            // FDMTCNT, instruction count limit
+    uint32_t                window;                                             // FDMTIVT, clears before this count are a fault
+    uint32_t                warn_margin;
+    volatile uint32_t       last_margin;
+    volatile uint32_t       min_margin;
+    volatile uint16_t       warnings;                                           // clears with less than warn_margin left
+    void                    (*callback)( uint32_t _margin );
+} DMT_OBJ;
+
+
+// *****************************************************************************
+// DMT Function Call Definitions
+// The timeout and window come from the FDMTCNT and FDMTIVT config words in
+// dspic33ck_core.c, set them to match the control period when DMT_EN is true
+// Once armed, the DMT cannot be stopped until the next reset
+// *****************************************************************************
+
+/**
+  @Description
+    Arms the Dead Man Timer, the control loop must call DMT_Clear() once per
+    period from here on, between the window and the timeout
+    Does nothing if DMT_EN is false
+
+  @Param
+    _warn_margin = clears with fewer instruction counts left than this call the callback
+    _callback = called with the remaining margin when the loop runs long, and
+                with 0 from the trap just before the reset, NULL for none
+
+  @Returns
+    None
+*/
+void DMT_Initialize( uint32_t _warn_margin, void (*_callback)( uint32_t _margin ) );
+
+/**
+  @Description
+    Clears the DMT and records how many instruction counts were left
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void DMT_Clear( void );
+
+/**
+  @Description
+    Returns the margin recorded at the last DMT_Clear()
+
+  @Param
+    None.
+
+  @Returns
+    instruction counts left before the timeout
+*/
+uint32_t DMT_GetMargin( void );
+
+/**
+  @Description
+    Returns the smallest margin recorded since DMT_Initialize()
+
+  @Param
+    None.
+
+  @Returns
+    instruction counts left before the timeout
+*/
+uint32_t DMT_GetMinMargin( void );
+
+/**
+  @Description
+    Returns the number of clears that came within the warning margin
+
+  @Param
+    None.
+
+  @Returns
+    warning count
+*/
+uint16_t DMT_GetWarnings( void );
+
+/**
+  @Description
+    Returns the DMT timeout programmed in the config words
+
+  @Param
+    None.
+
+  @Returns
+    timeout in instruction counts
+*/
+uint32_t DMT_GetTimeout( void );
+
+/**
+  @Description
+    Copies the record left by a trap reset, kept in persistent RAM across
+    resets and wiped on power-on
+
+  @Param
+    _diag = destination of the record
+
+  @Returns
+    true if a trap reset happened since power-on
+*/
+bool DMT_GetDiagnostic( DMT_DIAG *_diag );
+
+
+#endif //_DSPIC33CK_DMT_H
@@ -0,0 +1,374 @@
+/*
+ * File:            dspic33ck_foc.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for field-oriented motor control routines
+ */
+
+
+#ifdef __XC16__
+#include <xc.h>
+#include "dspic33ck_core.h"
+#endif
+#include "dspic33ck_foc.h"
+
+
+// *****************************************************************************
+// FOC Transform Routines
+//
+// - every sum of products is formed in 32 bits, rounded once and saturated
+// - integer widths are spelled out so a 16bit int (XC16) and a 32bit int
+//   (host) give the same results
+//
+// *****************************************************************************
+
+static q15_t FOC_Round( int32_t _x ) {                                          // Q30 sum of products to Q15
+    return Q15_Sat((_x + 0x4000) >> 15);
+}
+
+
+static q15_t FOC_Duty( int32_t _v ) {                                           // phase voltage to duty [0 - Q15_MAX]
+    _v = _v + FOC_DUTY_HALF;
+    if (_v < 0) {
+        return 0;
+    }
+    return Q15_Sat(_v);
+}
+
+
+void FOC_SinCos( uint16_t _angle, FOC_SINCOS *_result ) {
+    _result->sin = Q15_Sin(_angle);
+    _result->cos = Q15_Cos(_angle);
+}
+
+
+void FOC_Clarke( const FOC_ABC *_abc, FOC_ALPHABETA *_result ) {
+    _result->alpha = _abc->a;
+    _result->beta = FOC_Round(MATH_MULSS(_abc->a, FOC_ONE_BY_SQRT3) + 2 * MATH_MULSS(_abc->b, FOC_ONE_BY_SQRT3));
+}
+
+
+void FOC_Park( const FOC_ALPHABETA *_ab, const FOC_SINCOS *_sc, FOC_DQ *_result ) {
+    _result->d = FOC_Round(MATH_MULSS(_ab->alpha, _sc->cos) + MATH_MULSS(_ab->beta, _sc->sin));
+    _result->q = FOC_Round(MATH_MULSS(_ab->beta, _sc->cos) - MATH_MULSS(_ab->alpha, _sc->sin));
+}
+
+
+void FOC_InversePark( const FOC_DQ *_dq, const FOC_SINCOS *_sc, FOC_ALPHABETA *_result ) {
+    _result->alpha = FOC_Round(MATH_MULSS(_dq->d, _sc->cos) - MATH_MULSS(_dq->q, _sc->sin));
+    _result->beta = FOC_Round(MATH_MULSS(_dq->d, _sc->sin) + MATH_MULSS(_dq->q, _sc->cos));
+}
+
+
+void FOC_InverseClarke( const FOC_ALPHABETA *_ab, FOC_ABC *_result ) {
+    int32_t half;
+    int32_t term;
+
+    half = _ab->alpha >> 1;
+    term = (MATH_MULSS(_ab->beta, FOC_SQRT3_BY_2) + 0x4000) >> 15;
+    _result->a = _ab->alpha;
+    _result->b = Q15_Sat(term - half);
+    _result->c = Q15_Sat(-half - term);
+}
+
+
+void FOC_SVPWM( const FOC_ALPHABETA *_ab, FOC_ABC *_duty ) {
+    int32_t va;
+    int32_t vb;
+    int32_t vc;
+    int32_t high;
+    int32_t low;
+    int32_t half;
+    int32_t term;
+
+    half = _ab->alpha >> 1;
+    term = (MATH_MULSS(_ab->beta, FOC_SQRT3_BY_2) + 0x4000) >> 15;
+    va = _ab->alpha;                                                            // inverse Clarke, kept in 32 bits until the offset is added
+    vb = term - half;
+    vc = -half - term;
+
+    high = (va > vb) ? va : vb;
+    high = (vc > high) ? vc : high;
+    low = (va < vb) ? va : vb;
+    low = (vc < low) ? vc : low;
+    half = (high + low) >> 1;                                                   // zero sequence, centers the three duties
+
+    _duty->a = FOC_Duty(va - half);
+    _duty->b = FOC_Duty(vb - half);
+    _duty->c = FOC_Duty(vc - half);
+}
+
+
+void FOC_PIInitialize( FOC_PI *_pi, q15_t _kp, uint8_t _kp_shift, q15_t _ki, q15_t _limit ) {
+    _pi->kp = _kp;
+    _pi->kp_shift = (_kp_shift > 15) ? 15 : _kp_shift;
+    _pi->ki = _ki;
+    _pi->limit = _limit;
+    _pi->integral = 0;
+}
+
+
+q15_t FOC_PIUpdate( FOC_PI *_pi, q15_t _error ) {
+    q31_t limit;
+    int32_t output;
+
+    limit = (q31_t) _pi->limit << 16;
+    _pi->integral = Q15_Mac(_pi->integral, _pi->ki, _error);
+    if (_pi->integral > limit) {
+        _pi->integral = limit;
+    }
+    else if (_pi->integral < -limit) {
+        _pi->integral = -limit;
+    }
+
+    output = (MATH_MULSS(_pi->kp, _error) >> (15 - _pi->kp_shift)) + (_pi->integral >> 16);
+    if (output > _pi->limit) {
+        return _pi->limit;
+    }
+    if (output < -_pi->limit) {
+        return -_pi->limit;
+    }
+    return (q15_t) output;
+}
+
+
+void FOC_CurrentControl( FOC_CONTROL *_control, const FOC_ABC *_currents, uint16_t _angle, FOC_ABC *_duty ) {
+    FOC_SINCOS sc;
+    FOC_ALPHABETA ab;
+
+    FOC_SinCos(_angle, &sc);
+    FOC_Clarke(_currents, &ab);
+    FOC_Park(&ab, &sc, &_control->current);
+    _control->voltage.d = FOC_PIUpdate(&_control->d_pi, Q15_Sub(_control->id_ref, _control->current.d));
+    _control->voltage.q = FOC_PIUpdate(&_control->q_pi, Q15_Sub(_control->iq_ref, _control->current.q));
+    FOC_InversePark(&_control->voltage, &sc, &ab);
+    FOC_SVPWM(&ab, _duty);
+}
+
+
+static uint16_t FOC_Fold( uint16_t _signature, q15_t _value ) {
+    return (uint16_t) (((_signature << 1) | (_signature >> 15)) ^ (uint16_t) _value);
+}
+
+
+uint16_t FOC_SelfTest( void ) {
+    FOC_CONTROL control;
+    FOC_ABC currents;
+    FOC_ABC duty;
+    uint16_t seed;
+    uint16_t angle;
+    uint16_t signature;
+    uint16_t i;
+    uint8_t shift;
+
+    FOC_PIInitialize(&control.d_pi, 19661, 0, 1638, 16384);                     // kp 0.6, ki 0.05, limit 0.5
+    FOC_PIInitialize(&control.q_pi, 19661, 0, 1638, 16384);
+    seed = 0x1234;
+    angle = 0;
+    signature = 0;
+
+    for (i = 0; i < FOC_SELFTEST_STEPS; i++) {
+        shift = (i & 0x3F) ? 2 : 0;                                             // quarter scale currents, full scale every 64th step
+        seed = (uint16_t) (seed * 25173U + 13849U);
+        currents.a = (q15_t) seed >> shift;
+        seed = (uint16_t) (seed * 25173U + 13849U);
+        currents.b = (q15_t) seed >> shift;
+        currents.c = Q15_Sat(-(int32_t) currents.a - currents.b);
+        control.id_ref = (q15_t) (i << 5);
+        control.iq_ref = (q15_t) ((int16_t) (i << 6) - 16384);
+        angle = (uint16_t) (angle + 0x0139);
+
+        FOC_CurrentControl(&control, &currents, angle, &duty);
+
+        signature = FOC_Fold(signature, control.current.d);
+        signature = FOC_Fold(signature, control.current.q);
+        signature = FOC_Fold(signature, control.voltage.d);
+        signature = FOC_Fold(signature, control.voltage.q);
+        signature = FOC_Fold(signature, duty.a);
+        signature = FOC_Fold(signature, duty.b);
+        signature = FOC_Fold(signature, duty.c);
+    }
+
+    return signature;
+}
+
+
+
+#ifdef __XC16__
+// *****************************************************************************
+// FOC PWM and Sampling Routines
+//
+// - PWM clock = FOSC, center-aligned: one period = 2 * (PGxPER + 1) clocks
+// - PG2 and PG3 start each cycle on the PG1 trigger output, so all three
+//   count in lockstep
+// - PG1 TRIGA drives ADC trigger 1, both dedicated cores sample together
+//
+// *****************************************************************************
+
+static FOC_OBJ foc_obj;
+
+
+void FOC_Initialize( FOC_CALLBACK _callback ) {
+    uint16_t deadtime;
+
+    if (!FOC_EN) {
+        return;
+    }
+
+    foc_obj.callback = _callback;
+    foc_obj.offset_count = 0;
+    foc_obj.offset_sum_a = 0;
+    foc_obj.offset_sum_b = 0;
+    foc_obj.period = CLOCK_SystemFrequencyGet() / (2 * FOC_PWM_FREQUENCY) - 1;
+    deadtime = (uint32_t) FOC_DEADTIME_NS * (CLOCK_SystemFrequencyGet() / 1000000UL) / 1000;
+
+    _LATB10 = false;                                                            // PWM3H/L, PWM2H/L, PWM1H/L, low until the generators own them
+    _LATB11 = false;
+    _LATB12 = false;
+    _LATB13 = false;
+    _LATB14 = false;
+    _LATB15 = false;
+    _TRISB10 = false;
+    _TRISB11 = false;
+    _TRISB12 = false;
+    _TRISB13 = false;
+    _TRISB14 = false;
+    _TRISB15 = false;
+
+    PMD_ModuleEnable(PMD_PWM);                                                  // power up the PWM before accessing its registers
+
+    PCLKCON = 0x0000;                                                           // MCLKSEL FOSC; LOCK disabled;
+
+    PG1CONL = 0x000C;                                                           // ON disabled; CLKSEL Master clock; MODSEL Center-Aligned;
+    PG1CONH = 0x0000;                                                           // MDCSEL PG1DC; MPERSEL PG1PER; UPDMOD SOC update; SOCS Self-trigger;
+    PG1IOCONL = 0x3000;                                                         // OVRENH enabled; OVRENL enabled; OVRDAT 0b00; FLTDAT 0b00;
+    PG1IOCONH = 0x000C;                                                         // PMOD Complementary; PENH enabled; PENL enabled; POLH/POLL active-high;
+    PG1EVTL = 0x0000;                                                           // PGTRGSEL EOC event; UPDTRG User; ADTR1PS 1:1;
+    PG1EVTH = 0x0301;                                                           // IEVTSEL None; ADTR1EN1 PG1TRIGA triggers ADC Trigger 1;
+    PG1PER = foc_obj.period;
+    PG1DC = foc_obj.period >> 1;
+    PG1PHASE = 0;
+    PG1DTL = deadtime;
+    PG1DTH = deadtime;
+    PG1TRIGA = FOC_SAMPLE_DELAY;
+
+    PG2CONL = 0x000C;                                                           // ON disabled; CLKSEL Master clock; MODSEL Center-Aligned;
+    PG2CONH = 0x0001;                                                           // MDCSEL PG2DC; MPERSEL PG2PER; UPDMOD SOC update; SOCS PG1 trigger output;
+    PG2IOCONL = 0x3000;
+    PG2IOCONH = 0x000C;
+    PG2EVTL = 0x0000;
+    PG2EVTH = 0x0300;                                                           // IEVTSEL None; ADC triggers disabled;
+    PG2PER = foc_obj.period;
+    PG2DC = foc_obj.period >> 1;
+    PG2PHASE = 0;
+    PG2DTL = deadtime;
+    PG2DTH = deadtime;
+
+    PG3CONL = 0x000C;                                                           // ON disabled; CLKSEL Master clock; MODSEL Center-Aligned;
+    PG3CONH = 0x0001;                                                           // MDCSEL PG3DC; MPERSEL PG3PER; UPDMOD SOC update; SOCS PG1 trigger output;
+    PG3IOCONL = 0x3000;
+    PG3IOCONH = 0x000C;
+    PG3EVTL = 0x0000;
+    PG3EVTH = 0x0300;
+    PG3PER = foc_obj.period;
+    PG3DC = foc_obj.period >> 1;
+    PG3PHASE = 0;
+    PG3DTL = deadtime;
+    PG3DTH = deadtime;
+
+    Analog_SetPin(AN0);                                                         // phase a current, dedicated core 0
+    Analog_SetPin(AN1);                                                         // phase b current, dedicated core 1
+    ADC1_Disable();
+    ADC1_SetTriggerSource(AN0, ADC1_TRIGGER_PG1_TRIG1);
+    ADC1_SetTriggerSource(AN1, ADC1_TRIGGER_PG1_TRIG1);
+    ADC1_SetChannelInterrupt(AN1, true);                                        // AN0 converts in parallel and is ready too
+    ADC1_Enable();
+
+    PG2CONLbits.ON = true;                                                      // slaves wait for the first PG1 cycle
+    PG3CONLbits.ON = true;
+    PG1CONLbits.ON = true;
+}
+
+
+bool FOC_IsReady( void ) {
+    return foc_obj.offset_count >= FOC_OFFSET_PERIODS;
+}
+
+
+void FOC_Start( void ) {
+    PG1IOCONL &= ~0x3000;                                                       // OVRENH, OVRENL disabled, applied at the next period start
+    PG2IOCONL &= ~0x3000;
+    PG3IOCONL &= ~0x3000;
+}
+
+
+void FOC_Stop( void ) {
+    PG1IOCONL |= 0x3000;                                                        // OVRENH, OVRENL enabled with OVRDAT 0b00, all six low
+    PG2IOCONL |= 0x3000;
+    PG3IOCONL |= 0x3000;
+}
+
+
+void FOC_SetDuty( const FOC_ABC *_duty ) {
+    PG1DC = MATH_MULSU(_duty->a, foc_obj.period) >> 15;
+    PG2DC = MATH_MULSU(_duty->b, foc_obj.period) >> 15;
+    PG3DC = MATH_MULSU(_duty->c, foc_obj.period) >> 15;
+    PG1STATbits.UPDREQ = true;                                                  // the generators share a start of cycle, the new duties land together
+    PG2STATbits.UPDREQ = true;
+    PG3STATbits.UPDREQ = true;
+}
+
+
+uint16_t FOC_GetPeriod( void ) {
+    return foc_obj.period;
+}
+
+
+#if FOC_EN
+static q15_t FOC_Current( uint16_t _raw, int16_t _offset ) {                   // 12bit ADC counts to Q15
+    int32_t current;
+
+    current = ((int32_t) _raw - _offset) << 4;
+    if (FOC_CURRENT_INVERTED) {
+        current = -current;
+    }
+    return Q15_Sat(current);
+}
+
+
+void __attribute__ ( ( __interrupt__ , auto_psv ISR_CONTEXT ) ) _ADCAN1Interrupt ( void ) {
+    uint16_t raw_a;
+    uint16_t raw_b;
+
+    CPULOAD_ISR_ENTER();
+    raw_a = ADCBUF0;
+    raw_b = ADCBUF1;
+    IFS5bits.ADCAN1IF = false;
+
+    if (foc_obj.offset_count < FOC_OFFSET_PERIODS) {                            // outputs are held low until FOC_Start(), no current flows
+        foc_obj.offset_sum_a += raw_a;
+        foc_obj.offset_sum_b += raw_b;
+        foc_obj.offset_count++;
+        if (foc_obj.offset_count == FOC_OFFSET_PERIODS) {
+            foc_obj.offset_a = foc_obj.offset_sum_a / FOC_OFFSET_PERIODS;
+            foc_obj.offset_b = foc_obj.offset_sum_b / FOC_OFFSET_PERIODS;
+        }
+        CPULOAD_ISR_EXIT(CPULOAD_ADC);
+        return;
+    }
+
+    foc_obj.currents.a = FOC_Current(raw_a, foc_obj.offset_a);
+    foc_obj.currents.b = FOC_Current(raw_b, foc_obj.offset_b);
+    foc_obj.currents.c = Q15_Sat(-(int32_t) foc_obj.currents.a - foc_obj.currents.b);
+    if (foc_obj.callback) {
+        foc_obj.callback(&foc_obj.currents);
+    }
+    CPULOAD_ISR_EXIT(CPULOAD_ADC);
+}
+#endif
+#endif
+
+
+/**
+ End of File
+*/
@@ -0,0 +1,333 @@
+/*
+ * File:            dspic33ck_foc.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for field-oriented motor control routines
+ */
+
+
+#ifndef _DSPIC33CK_FOC_H
+#define _DSPIC33CK_FOC_H
+
+
+#ifdef __XC16__
+#include <xc.h>
+#endif
+#include <stdint.h>
+#include <stdbool.h>
+#include "dspic33ck_math.h"
+
+
+#define FOC_PWM_FREQUENCY             20000UL   // Hz, center-aligned, one current loop pass per period
+#define FOC_DEADTIME_NS               500   // both edges
+#define FOC_SAMPLE_DELAY              0     // PWM clocks after the period start, all low-side switches are on there
+#define FOC_OFFSET_PERIODS            256   // periods averaged for the current sense offsets, power of 2
+#define FOC_CURRENT_INVERTED          false // true if the current sense amplifier output falls with positive phase current
+
+#define FOC_ONE_BY_SQRT3              18919 // Q15(0.57735), also the largest |v_alphabeta| SVPWM reproduces without distortion
+#define FOC_SQRT3_BY_2                28378 // Q15(0.86603)
+#define FOC_DUTY_HALF                 0x4000    // Q15(0.5), zero voltage
+
+#define FOC_SELFTEST_STEPS            512
+#define FOC_SELFTEST_SIGNATURE        0x63DA    // FOC_SelfTest() result, from tools/foc_model.py
+
+
+typedef struct _FOC_ABC_STRUCT {
+    q15_t                   a;
+    q15_t                   b;
+    q15_t                   c;
+} FOC_ABC;
+
+
+typedef struct _FOC_ALPHABETA_STRUCT {
+    q15_t                   alpha;
+    q15_t                   beta;
+} FOC_ALPHABETA;
+
+
+typedef struct _FOC_DQ_STRUCT {
+    q15_t                   d;
+    q15_t                   q;
+} FOC_DQ;
+
+
+typedef struct _FOC_SINCOS_STRUCT {
+    q15_t                   sin;
+    q15_t                   cos;
+} FOC_SINCOS;
+
+
+typedef struct _FOC_PI_STRUCT {
+    q15_t                   kp;                                                 // Q15, proportional gain = kp * 2^kp_shift
+    uint8_t                 kp_shift;                                           // [0 - 15]
+    q15_t                   ki;                                                 // Q15, integral gain per sample
+    q15_t                   limit;                                              // output and integrator clamp, Q15 > 0
+    q31_t                   integral;
+} FOC_PI;
+
+
+typedef struct _FOC_CONTROL_STRUCT {
+    FOC_PI                  d_pi;
+    FOC_PI                  q_pi;
+    q15_t                   id_ref;                                             // Q15 of full scale current
+    q15_t                   iq_ref;
+    FOC_DQ                  current;                                            // last measured id, iq
+    FOC_DQ                  voltage;                                            // last commanded vd, vq, Q15 of the DC bus
+} FOC_CONTROL;
+
+
+typedef void (*FOC_CALLBACK)( const FOC_ABC *_currents );
+
+
+typedef struct _FOC_OBJ_STRUCT {
+    uint16_t                period;                                             // PGxPER, PWM clocks per half period
+    volatile uint16_t       offset_count;                                       // FOC_OFFSET_PERIODS = offsets valid
+    uint32_t                offset_sum_a;
+    uint32_t                offset_sum_b;
+    int16_t                 offset_a;                                           // raw counts at zero current
+    int16_t                 offset_b;
+    FOC_ABC                 currents;
+    FOC_CALLBACK            callback;
+} FOC_OBJ;
+
+
+// *****************************************************************************
+// FOC Transform Function Call Definitions
+// Voltages are Q15 fractions of the DC bus, currents Q15 fractions of the
+// current sense full scale, angles are uint16_t electrical angles with
+// 65536 = 360 degrees. Only the integer math of dspic33ck_math.h is used, so
+// any C99 compiler produces the same bits as XC16, see tools/foc_model.py
+// *****************************************************************************
+
+/**
+  @Description
+    Sine and cosine of an angle, computed once per loop pass for Park and
+    inverse Park
+
+  @Param
+    _angle = electrical angle [0 - 65535]
+    _result = sin and cos in Q15
+
+  @Returns
+    None
+*/
+void FOC_SinCos( uint16_t _angle, FOC_SINCOS *_result );
+
+/**
+  @Description
+    Clarke transform, a + b + c = 0 is assumed so c is not used
+    alpha = a, beta = (a + 2b) / sqrt(3)
+
+  @Param
+    _abc = phase currents
+    _result = stationary frame components
+
+  @Returns
+    None
+*/
+void FOC_Clarke( const FOC_ABC *_abc, FOC_ALPHABETA *_result );
+
+/**
+  @Description
+    Park transform into the rotor frame
+    d = alpha * cos + beta * sin, q = beta * cos - alpha * sin
+
+  @Param
+    _ab = stationary frame components
+    _sc = FOC_SinCos() of the rotor angle
+    _result = rotor frame components
+
+  @Returns
+    None
+*/
+void FOC_Park( const FOC_ALPHABETA *_ab, const FOC_SINCOS *_sc, FOC_DQ *_result );
+
+/**
+  @Description
+    Inverse Park transform into the stationary frame
+    alpha = d * cos - q * sin, beta = d * sin + q * cos
+
+  @Param
+    _dq = rotor frame components
+    _sc = FOC_SinCos() of the rotor angle
+    _result = stationary frame components
+
+  @Returns
+    None
+*/
+void FOC_InversePark( const FOC_DQ *_dq, const FOC_SINCOS *_sc, FOC_ALPHABETA *_result );
+
+/**
+  @Description
+    Inverse Clarke transform
+    a = alpha, b = -alpha / 2 + sqrt(3) / 2 * beta, c = -alpha / 2 - sqrt(3) / 2 * beta
+
+  @Param
+    _ab = stationary frame components
+    _result = phase values
+
+  @Returns
+    None
+*/
+void FOC_InverseClarke( const FOC_ALPHABETA *_ab, FOC_ABC *_result );
+
+/**
+  @Description
+    Space vector modulation by min-max zero sequence injection, the same
+    switching pattern as the sector and dwell time method without a divide
+    Linear up to |v_alphabeta| = FOC_ONE_BY_SQRT3, beyond that the duties clip
+
+  @Param
+    _ab = voltage vector, Q15 of the DC bus
+    _duty = phase duties, Q15 [0 - Q15_MAX], FOC_DUTY_HALF = 0V
+
+  @Returns
+    None
+*/
+void FOC_SVPWM( const FOC_ALPHABETA *_ab, FOC_ABC *_duty );
+
+/**
+  @Description
+    Sets the gains of a PI controller and clears its integrator
+
+  @Param
+    _pi = controller
+    _kp = Q15 proportional gain, scaled by 2^_kp_shift
+    _kp_shift = [0 - 15]
+    _ki = Q15 integral gain per sample
+    _limit = output and integrator clamp, Q15 > 0
+
+  @Returns
+    None
+*/
+void FOC_PIInitialize( FOC_PI *_pi, q15_t _kp, uint8_t _kp_shift, q15_t _ki, q15_t _limit );
+
+/**
+  @Description
+    One PI controller step, the integrator is clamped to the output limit so
+    it does not wind up while the output saturates
+
+  @Param
+    _pi = controller
+    _error = reference - measurement, Q15
+
+  @Returns
+    output [-limit, limit]
+*/
+q15_t FOC_PIUpdate( FOC_PI *_pi, q15_t _error );
+
+/**
+  @Description
+    One current loop pass: Clarke, Park, d and q PI controllers, inverse Park
+    and SVPWM. Estimated at about 500 instruction cycles from the code, not
+    measured, 40% of a 20kHz period at 25 MIPS; CPULoad_GetLongest(CPULOAD_ADC)
+    gives the measured pass. Budgeted in ADC_ISR_CYCLES when FOC_EN is true
+    Called from the FOC_CALLBACK with the currents it receives
+
+  @Param
+    _control = controllers and references, current and voltage are updated
+    _currents = phase currents
+    _angle = electrical rotor angle [0 - 65535]
+    _duty = phase duties for FOC_SetDuty()
+
+  @Returns
+    None
+*/
+void FOC_CurrentControl( FOC_CONTROL *_control, const FOC_ABC *_currents, uint16_t _angle, FOC_ABC *_duty );
+
+/**
+  @Description
+    Runs FOC_CurrentControl() over FOC_SELFTEST_STEPS fixed current and angle
+    vectors and folds every output into a 16bit signature. The dsPIC result
+    must equal FOC_SELFTEST_SIGNATURE, the value tools/foc_model.py and a host
+    build of this file compute, else the transforms are not bit-exact
+
+  @Param
+    None.
+
+  @Returns
+    signature
+*/
+uint16_t FOC_SelfTest( void );
+
+
+// *****************************************************************************
+// FOC PWM and Sampling Function Call Definitions
+// PG1, PG2 and PG3 drive phases a, b and c as complementary center-aligned
+// pairs on the fixed pins PWM1H/L = RB14/RB15, PWM2H/L = RB12/RB13 and
+// PWM3H/L = RB10/RB11. Phase a current is sensed on AN0 (RA0), phase b on
+// AN1 (RB2). PG1 triggers both dedicated ADC cores at the period start and
+// the AN1 conversion done interrupt hands the currents to the callback
+// *****************************************************************************
+
+/**
+  @Description
+    Sets up PG1 - PG3 from FOSC at FOC_PWM_FREQUENCY with FOC_DEADTIME_NS,
+    outputs held low, and the PWM triggered current sampling. Current sense
+    offsets are measured over the first FOC_OFFSET_PERIODS periods
+    Needs FOC_EN
+
+  @Param
+    _callback = current loop, runs at ADC_IPL once per PWM period
+
+  @Returns
+    None
+*/
+void FOC_Initialize( FOC_CALLBACK _callback );
+
+/**
+  @Description
+    Returns true once the current sense offsets are measured and the
+    callback is being called
+
+  @Param
+    None.
+
+  @Returns
+    true if ready
+*/
+bool FOC_IsReady( void );
+
+/**
+  @Description
+    Releases the PWM outputs to the duty cycles, FOC_Stop() holds all six low
+    Call FOC_Start() only after FOC_IsReady(), current must not flow while
+    the offsets are measured
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void FOC_Start( void );
+
+void FOC_Stop( void );
+
+/**
+  @Description
+    Writes the three phase duties, they take effect together at the next
+    period start
+
+  @Param
+    _duty = Q15 [0 - Q15_MAX] per phase, from FOC_SVPWM()
+
+  @Returns
+    None
+*/
+void FOC_SetDuty( const FOC_ABC *_duty );
+
+/**
+  @Description
+    Returns the PGxPER value, PWM clocks per half period
+
+  @Param
+    None.
+
+  @Returns
+    period
+*/
+uint16_t FOC_GetPeriod( void );
+
+
+#endif //_DSPIC33CK_FOC_H
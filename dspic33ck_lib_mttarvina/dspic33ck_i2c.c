@@ -0,0 +1,341 @@
+/*
+ * File:            dspic33ck_i2c.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for interrupt driven I2C master routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_i2c.h"
+
+
+#define I2C_STATE_IDLE                0x0
+#define I2C_STATE_START               0x1
+#define I2C_STATE_WRITE               0x2
+#define I2C_STATE_RESTART             0x3
+#define I2C_STATE_ADDR_READ           0x4
+#define I2C_STATE_READ                0x5
+#define I2C_STATE_ACK                 0x6
+#define I2C_STATE_STOP                0x7
+#define I2C_STATE_RECOVER             0x8   // SCL toggled by the port, one edge per 1ms tick
+#define I2C_STATE_RECOVER_STOP        0x9   // module back on, STOP in progress
+
+
+// *****************************************************************************
+// I2C1 Routines
+//
+// - transactions are queued by I2C1_Submit() and run one after another
+// - each MI2C1 interrupt advances the current transaction by one bus event
+// - I2C1 and SCCP1 share the same priority so the timeout never preempts the state machine
+// - the main loop masks both while it touches the queue, see I2C1_Lock()
+// - bus recovery is a state too: the 1ms tick toggles SCL one edge at a
+//   time until the slave lets go of SDA, then a STOP resets every slave
+//
+// *****************************************************************************
+
+static I2C_OBJ i2c1_obj;
+static uint8_t i2c1_result;                                                     // status given to the current transaction at STOP
+
+
+static void I2C1_Lock( bool _lock ) {
+    if (_lock) {
+        i2c1_obj.saved_mi2c1ie = _MI2C1IE;
+        i2c1_obj.saved_cct1ie = _CCT1IE;
+        _MI2C1IE = false;
+        _CCT1IE = false;                                                        // I2C1_TimeoutTick() also finishes and starts transactions
+    }
+    else {
+        _MI2C1IE = i2c1_obj.saved_mi2c1ie;
+        _CCT1IE = i2c1_obj.saved_cct1ie;                                        // stays off if the application turned the tick off
+    }
+}
+
+
+static void I2C1_StartNext( void ) {
+    if (i2c1_obj.count == 0) {
+        i2c1_obj.state = I2C_STATE_IDLE;
+        return;
+    }
+    i2c1_obj.index = 0;
+    i2c1_obj.elapsed_ms = 0;
+    i2c1_result = I2C_DONE;
+    i2c1_obj.state = I2C_STATE_START;
+    I2C1CONLbits.SEN = true;
+}
+
+
+static void I2C1_Finish( uint8_t _status ) {
+    I2C_TRANSACTION *transaction;
+
+    transaction = i2c1_obj.queue[i2c1_obj.head];
+    i2c1_obj.head = (i2c1_obj.head + 1) % I2C1_QUEUE_SIZE;
+    i2c1_obj.count--;
+
+    switch (_status) {
+        case I2C_DONE:
+            i2c1_obj.stats.completed++;
+            break;
+        case I2C_NACK:
+            i2c1_obj.stats.nacks++;
+            break;
+        case I2C_BUS_ERROR:
+            i2c1_obj.stats.bus_errors++;
+            break;
+        case I2C_TIMEOUT:
+            i2c1_obj.stats.timeouts++;
+            break;
+    }
+
+    transaction->status = _status;
+    if (transaction->callback) {
+        transaction->callback(transaction);
+    }
+}
+
+
+static void I2C1_Stop( uint8_t _status ) {
+    i2c1_result = _status;
+    i2c1_obj.state = I2C_STATE_STOP;
+    I2C1CONLbits.PEN = true;
+}
+
+
+static void I2C1_RecoverEnd( void ) {
+    TRISB = TRISB | PWMx_GetPinRegister(I2C1_SCL_PIN);                          // release SCL to the module
+    I2C1STATbits.BCL = false;
+    I2C1STATbits.IWCOL = false;
+    I2C1CONLbits.I2CEN = true;
+    i2c1_obj.elapsed_ms = 0;
+    i2c1_obj.state = I2C_STATE_RECOVER_STOP;
+    I2C1CONLbits.PEN = true;                                                    // STOP resets every slave, the MI2C1 interrupt moves on
+}
+
+
+static void I2C1_RecoverStart( void ) {
+    uint16_t pins;
+
+    I2C1CONLbits.I2CEN = false;                                                 // release the pins to the port
+    if (!I2C1_EN) {
+        I2C1_RecoverEnd();                                                      // no tick to clock SCL, only send the STOP
+        return;
+    }
+    pins = PWMx_GetPinRegister(I2C1_SCL_PIN) | PWMx_GetPinRegister(I2C1_SDA_PIN);
+    ANSELB = ANSELB & ~pins;                                                    // digital, SDA is read back
+    TRISB = TRISB | PWMx_GetPinRegister(I2C1_SDA_PIN);
+    Digital_DrvPin(I2C1_SCL_PIN, HIGH);
+    TRISB = TRISB & ~PWMx_GetPinRegister(I2C1_SCL_PIN);
+    i2c1_obj.recover_edges = 0;
+    i2c1_obj.state = I2C_STATE_RECOVER;
+}
+
+
+static void I2C1_RecoverTick( void ) {
+    if (i2c1_obj.recover_edges & 0x01) {                                        // SCL is low, finish the clock
+        Digital_DrvPin(I2C1_SCL_PIN, HIGH);
+        i2c1_obj.recover_edges++;
+        return;
+    }
+    if (Digital_ReadPin(I2C1_SDA_PIN) || i2c1_obj.recover_edges >= 2 * I2C1_RECOVER_CLOCKS) {
+        I2C1_RecoverEnd();                                                      // SDA released, or the slave is beyond help
+        return;
+    }
+    Digital_DrvPin(I2C1_SCL_PIN, LOW);
+    i2c1_obj.recover_edges++;
+}
+
+
+bool I2C1_Initialize( uint16_t _clock_khz ) {
+    uint32_t brg;
+
+    if (_clock_khz == 0) {
+        return false;
+    }
+    brg = CLOCK_InstructionFrequencyGet() / (2000UL * _clock_khz);              // Fscl = Fcy / (2 * (BRG + 2))
+    brg = (brg > I2C1_BRG_MIN + 2) ? brg - 2 : I2C1_BRG_MIN;                    // above the fastest clock runs at the fastest clock
+    if (brg > I2C1_BRG_MAX) {
+        brg = I2C1_BRG_MAX;
+    }
+
+    PMD_ModuleEnable(PMD_I2C1);                                                 // power up I2C1 before accessing its registers
+
+    i2c1_obj.head = 0;
+    i2c1_obj.tail = 0;
+    i2c1_obj.count = 0;
+    i2c1_obj.state = I2C_STATE_IDLE;
+
+    //    MI2C1I: I2C1 Master Event
+    //    Priority: I2C1_IPL, same as SCCP1 which runs the timeout
+    _MI2C1IP = I2C1_IPL;
+
+    I2C1CONL = 0x0000;                                                          // I2CEN disabled; A10M 7 Bit; DISSLW enabled; SMEN disabled;
+    I2C1CONH = 0x0000;                                                          // BOEN disabled; SDAHT 100ns; SBCDE disabled;
+    I2C1STAT = 0x0000;
+    I2C1BRG = (uint16_t) brg;
+
+    _MI2C1IF = false;
+    _MI2C1IE = true;
+
+    I2C1CONLbits.I2CEN = true;
+
+    return true;
+}
+
+
+bool I2C1_Submit( I2C_TRANSACTION *_transaction ) {
+
+    if (_transaction->write_len == 0 && _transaction->read_len == 0) {
+        return false;
+    }
+
+    I2C1_Lock(true);                                                            // queue is shared with the I2C1 and SCCP1 interrupts
+    if (i2c1_obj.count >= I2C1_QUEUE_SIZE) {
+        I2C1_Lock(false);
+        return false;
+    }
+    _transaction->status = I2C_PENDING;
+    i2c1_obj.queue[i2c1_obj.tail] = _transaction;
+    i2c1_obj.tail = (i2c1_obj.tail + 1) % I2C1_QUEUE_SIZE;
+    i2c1_obj.count++;
+    if (i2c1_obj.state == I2C_STATE_IDLE) {
+        I2C1_StartNext();
+    }
+    I2C1_Lock(false);
+
+    return true;
+}
+
+
+bool I2C1_IsIdle( void ) {
+    return (i2c1_obj.state == I2C_STATE_IDLE);
+}
+
+
+const I2C_STATS* I2C1_GetStats( void ) {
+    return &i2c1_obj.stats;
+}
+
+
+void I2C1_TimeoutTick( void ) {                                                 // same IPL as MI2C1, never preempts it
+    if (i2c1_obj.state == I2C_STATE_IDLE) {
+        return;
+    }
+    if (i2c1_obj.state == I2C_STATE_RECOVER) {
+        I2C1_RecoverTick();
+        return;
+    }
+    i2c1_obj.elapsed_ms++;
+    if (i2c1_obj.elapsed_ms <= I2C1_TIMEOUT_MS) {
+        return;
+    }
+    if (i2c1_obj.state == I2C_STATE_RECOVER_STOP) {
+        I2C1_StartNext();                                                       // STOP never completed, carry on anyway
+        return;
+    }
+    I2C1_Finish(I2C_TIMEOUT);
+    _MI2C1IF = false;
+    I2C1_RecoverStart();
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _MI2C1Interrupt ( void ) {
+    I2C_TRANSACTION *transaction;
+
+    CPULOAD_ISR_ENTER();
+    _MI2C1IF = false;
+    if (i2c1_obj.state == I2C_STATE_IDLE || i2c1_obj.state == I2C_STATE_RECOVER) {
+        CPULOAD_ISR_EXIT(CPULOAD_I2C1);
+        return;                                                                 // no transaction in progress
+    }
+    if (i2c1_obj.state == I2C_STATE_RECOVER_STOP) {
+        I2C1STATbits.BCL = false;
+        I2C1STATbits.IWCOL = false;
+        I2C1_StartNext();                                                       // bus recovered
+        CPULOAD_ISR_EXIT(CPULOAD_I2C1);
+        return;
+    }
+    transaction = i2c1_obj.queue[i2c1_obj.head];
+
+    if (I2C1STATbits.BCL || I2C1STATbits.IWCOL) {                               // lost arbitration or write collision
+        I2C1_Finish(I2C_BUS_ERROR);
+        I2C1_RecoverStart();
+        CPULOAD_ISR_EXIT(CPULOAD_I2C1);
+        return;
+    }
+
+    switch (i2c1_obj.state) {
+        case I2C_STATE_START:
+            if (transaction->write_len > 0) {
+                I2C1TRN = transaction->address << 1;                            // address + write
+                i2c1_obj.state = I2C_STATE_WRITE;
+            }
+            else {
+                I2C1TRN = (transaction->address << 1) | 0x01;                   // address + read
+                i2c1_obj.state = I2C_STATE_ADDR_READ;
+            }
+            break;
+
+        case I2C_STATE_WRITE:                                                   // address or data byte was sent
+            if (I2C1STATbits.ACKSTAT) {
+                I2C1_Stop(I2C_NACK);
+            }
+            else if (i2c1_obj.index < transaction->write_len) {
+                I2C1TRN = transaction->write_data[i2c1_obj.index++];
+            }
+            else if (transaction->read_len > 0) {
+                i2c1_obj.state = I2C_STATE_RESTART;
+                I2C1CONLbits.RSEN = true;
+            }
+            else {
+                I2C1_Stop(I2C_DONE);
+            }
+            break;
+
+        case I2C_STATE_RESTART:
+            I2C1TRN = (transaction->address << 1) | 0x01;                       // address + read
+            i2c1_obj.state = I2C_STATE_ADDR_READ;
+            break;
+
+        case I2C_STATE_ADDR_READ:
+            if (I2C1STATbits.ACKSTAT) {
+                I2C1_Stop(I2C_NACK);
+            }
+            else {
+                i2c1_obj.index = 0;
+                i2c1_obj.state = I2C_STATE_READ;
+                I2C1CONLbits.RCEN = true;
+            }
+            break;
+
+        case I2C_STATE_READ:
+            transaction->read_data[i2c1_obj.index++] = I2C1RCV;
+            I2C1CONLbits.ACKDT = (i2c1_obj.index >= transaction->read_len);     // NACK the last byte
+            i2c1_obj.state = I2C_STATE_ACK;
+            I2C1CONLbits.ACKEN = true;
+            break;
+
+        case I2C_STATE_ACK:
+            if (i2c1_obj.index < transaction->read_len) {
+                i2c1_obj.state = I2C_STATE_READ;
+                I2C1CONLbits.RCEN = true;
+            }
+            else {
+                I2C1_Stop(I2C_DONE);
+            }
+            break;
+
+        case I2C_STATE_STOP:
+            I2C1_Finish(i2c1_result);
+            I2C1_StartNext();
+            break;
+
+        default:
+            break;
+    }
+    CPULOAD_ISR_EXIT(CPULOAD_I2C1);
+}
+
+
+/**
+ End of File
+*/
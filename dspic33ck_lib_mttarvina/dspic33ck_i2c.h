@@ -0,0 +1,140 @@
+/*
+ * File:            dspic33ck_i2c.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for interrupt driven I2C master routines
+ */
+
+
+#ifndef _DSPIC33CK_I2C_H
+#define _DSPIC33CK_I2C_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define I2C1_QUEUE_SIZE               8     // max number of queued transactions
+#define I2C1_TIMEOUT_MS               5     // a transaction not finished within this time is aborted, needs SCCP1_EN
+#define I2C1_RECOVER_CLOCKS           9     // SCL clocks at most, one edge per 1ms tick, before the STOP is sent anyway
+#define I2C1_BRG_MIN                  2     // I2C1BRG 0 and 1 are not supported
+#define I2C1_BRG_MAX                  0xFFFF
+#define I2C1_SCL_PIN                  PB8   // SCL1 with ALTI2C1 = OFF
+#define I2C1_SDA_PIN                  PB9   // SDA1 with ALTI2C1 = OFF
+
+#define I2C_PENDING                   0x0   // transaction status
+#define I2C_DONE                      0x1
+#define I2C_NACK                      0x2
+#define I2C_BUS_ERROR                 0x3
+#define I2C_TIMEOUT                   0x4
+
+
+typedef struct _I2C_TRANSACTION_STRUCT {
+    uint8_t                 address;                                            // 7bit slave address
+    const uint8_t           *write_data;                                        // written first, may be NULL
+    uint8_t                 write_len;
+    uint8_t                 *read_data;                                         // read after a repeated start, may be NULL
+    uint8_t                 read_len;
+    void                    (*callback)( struct _I2C_TRANSACTION_STRUCT *_transaction );  // called from the I2C interrupt, may be NULL
+    volatile uint8_t        status;
+} I2C_TRANSACTION;
+
+
+typedef struct _I2C_STATS_STRUCT {
+    volatile uint16_t       completed;
+    volatile uint16_t       nacks;
+    volatile uint16_t       bus_errors;
+    volatile uint16_t       timeouts;
+} I2C_STATS;
+
+
+typedef struct _I2C_OBJ_STRUCT {
+    I2C_TRANSACTION         *queue[I2C1_QUEUE_SIZE];
+    volatile uint8_t        head;
+    volatile uint8_t        tail;
+    volatile uint8_t        count;
+    volatile uint8_t        state;
+    volatile uint8_t        index;
+    volatile uint8_t        elapsed_ms;
+    volatile uint8_t        recover_edges;                                      // SCL edges sent in bus recovery
+    bool                    saved_mi2c1ie;                                      // interrupt enables before I2C1_Lock()
+    bool                    saved_cct1ie;
+    I2C_STATS               stats;
+} I2C_OBJ;
+
+
+// *****************************************************************************
+// I2C1 Function Call Definitions
+// Master mode, every bus event is handled in the MI2C1 interrupt
+// *****************************************************************************
+
+/**
+  @Description
+    Initializes I2C1 as master
+    Timeouts are counted in the SCCP1 1ms tick, set I2C1_EN and SCCP1_EN
+    The tick also clocks SCL during bus recovery, without it a collision or
+    timeout only sends a STOP
+
+  @Param
+    _clock_khz = SCL frequency in kHz, e.g. 100 or 400, rates outside the
+                 divider range run at the nearest one
+
+  @Returns
+    false if _clock_khz is 0, I2C1 is left untouched
+*/
+bool I2C1_Initialize( uint16_t _clock_khz );
+
+/**
+  @Description
+    Queues a transaction, returns immediately
+    A write-then-read uses both write_data and read_data with a repeated start.
+    Multi-message sequences are submitted as consecutive transactions and run
+    in order. The transaction must stay valid until its status is not I2C_PENDING
+
+  @Param
+    _transaction = transaction to run
+
+  @Returns
+    false if the queue is full
+*/
+bool I2C1_Submit( I2C_TRANSACTION *_transaction );
+
+/**
+  @Description
+    Checks if the queue is empty and the bus is idle
+
+  @Param
+    None.
+
+  @Returns
+    true if idle
+*/
+bool I2C1_IsIdle( void );
+
+/**
+  @Description
+    Returns the transaction counters
+
+  @Param
+    None.
+
+  @Returns
+    pointer to the counters of completed, NACKed, bus error and timed out transactions
+*/
+const I2C_STATS* I2C1_GetStats( void );
+
+/**
+  @Description
+    Aborts a stuck transaction and steps bus recovery by one SCL edge
+    Called every 1ms from the SCCP1 interrupt when I2C1_EN is true
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void I2C1_TimeoutTick( void );
+
+
+#endif //_DSPIC33CK_I2C_H
@@ -0,0 +1,235 @@
+/*
+ * File:            dspic33ck_input.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for change notification (CN) digital input routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_input.h"
+
+
+// *****************************************************************************
+// Input Routines
+//
+// - CNCONx in edge style: CNEN0x = rising edges, CNEN1x = falling edges, CNFx = flags
+// - every pin listens to both edges so its state stays current, _edge only
+//   filters the callback; on debounced pins each edge restarts the countdown
+// - CNA, CNB and SCCP1 share the same priority so the pin table is never accessed concurrently
+//
+// *****************************************************************************
+
+static INPUT_OBJ input_obj;
+
+
+static INPUT_PIN* Input_Find( uint8_t _pin ) {
+    uint8_t i;
+
+    for (i = 0; i < input_obj.count; i++) {
+        if (input_obj.pins[i].pin == _pin) {
+            return &input_obj.pins[i];
+        }
+    }
+    return 0;
+}
+
+
+static void Input_Lock( bool _lock ) {
+    if (_lock) {
+        input_obj.saved_cnaie = _CNAIE;
+        input_obj.saved_cnbie = _CNBIE;
+        input_obj.saved_cct1ie = _CCT1IE;
+        _CNAIE = false;
+        _CNBIE = false;
+        _CCT1IE = false;
+    }
+    else {
+        _CNAIE = input_obj.saved_cnaie;
+        _CNBIE = input_obj.saved_cnbie;
+        _CCT1IE = input_obj.saved_cct1ie;                                       // stays off if the application turned the tick off
+    }
+}
+
+
+static void Input_Report( INPUT_PIN *_input, bool _state ) {
+    _input->state = _state;
+    if (!_input->callback) {
+        return;
+    }
+    if ((_state && (_input->edge & INPUT_RISING)) || (!_state && (_input->edge & INPUT_FALLING))) {
+        _input->callback(_input->pin, _state);
+    }
+}
+
+
+static void Input_Changed( uint8_t _port, uint16_t _flags ) {
+    INPUT_PIN *input;
+    uint16_t level;
+    uint8_t i;
+
+    level = Digital_ReadPort(_port);
+    for (i = 0; i < input_obj.count; i++) {
+        input = &input_obj.pins[i];
+        if (input->port != _port || !(input->mask & _flags)) {
+            continue;
+        }
+        if (input->debounce_ms == 0) {
+            Input_Report(input, (level & input->mask) != 0);
+        }
+        else {
+            input->countdown = input->debounce_ms;                              // still bouncing, start over
+        }
+    }
+}
+
+
+bool Input_Attach( uint8_t _pin, uint8_t _edge, uint8_t _pull, uint8_t _debounce_ms, void (*_callback)( uint8_t _pin, bool _state ) ) {
+    INPUT_PIN *input;
+    uint16_t mask;
+
+    Input_Detach(_pin);
+    if (input_obj.count >= INPUT_MAX_PINS) {
+        return false;
+    }
+
+    mask = PWMx_GetPinRegister(_pin);
+
+    Input_Lock(true);
+    input = &input_obj.pins[input_obj.count];
+    input->pin = _pin;
+    input->mask = mask;
+    input->edge = _edge;
+    input->debounce_ms = _debounce_ms;
+    input->countdown = 0;
+    input->callback = _callback;
+
+    if (_pin <= PA4 && _pin >= PA0) {
+        input->port = PORT_A;
+        TRISA = TRISA | mask;                                                   // digital input
+        ANSELA = ANSELA & ~mask;
+        CNPUA = (_pull == INPUT_PULL_UP) ? (CNPUA | mask) : (CNPUA & ~mask);
+        CNPDA = (_pull == INPUT_PULL_DOWN) ? (CNPDA | mask) : (CNPDA & ~mask);
+        CNCONA = 0x8800;                                                        // ON enabled; CNSTYLE edge style;
+        CNEN0A = CNEN0A | mask;
+        CNEN1A = CNEN1A | mask;
+        CNFA = CNFA & ~mask;
+        input->state = (PORTA & mask) != 0;
+
+        //    CNAI: Change Notification A
+        //    Priority: INPUT_IPL, same as SCCP1 which runs the debounce
+        _CNAIP = INPUT_IPL;
+        _CNAIF = false;
+        input_obj.saved_cnaie = true;                                           // enabled by Input_Lock(false)
+    }
+    else if (_pin <= PB15 && _pin >= PB0) {
+        input->port = PORT_B;
+        TRISB = TRISB | mask;                                                   // digital input
+        ANSELB = ANSELB & ~mask;
+        CNPUB = (_pull == INPUT_PULL_UP) ? (CNPUB | mask) : (CNPUB & ~mask);
+        CNPDB = (_pull == INPUT_PULL_DOWN) ? (CNPDB | mask) : (CNPDB & ~mask);
+        CNCONB = 0x8800;                                                        // ON enabled; CNSTYLE edge style;
+        CNEN0B = CNEN0B | mask;
+        CNEN1B = CNEN1B | mask;
+        CNFB = CNFB & ~mask;
+        input->state = (PORTB & mask) != 0;
+
+        //    CNBI: Change Notification B
+        //    Priority: INPUT_IPL, same as SCCP1 which runs the debounce
+        _CNBIP = INPUT_IPL;
+        _CNBIF = false;
+        input_obj.saved_cnbie = true;                                           // enabled by Input_Lock(false)
+    }
+    else {
+        Input_Lock(false);
+        return false;
+    }
+    input_obj.count++;
+    Input_Lock(false);
+
+    return true;
+}
+
+
+void Input_Detach( uint8_t _pin ) {
+    INPUT_PIN *input;
+
+    input = Input_Find(_pin);
+    if (!input) {
+        return;
+    }
+
+    Input_Lock(true);
+    if (input->port == PORT_A) {
+        CNEN0A = CNEN0A & ~input->mask;
+        CNEN1A = CNEN1A & ~input->mask;
+    }
+    else {
+        CNEN0B = CNEN0B & ~input->mask;
+        CNEN1B = CNEN1B & ~input->mask;
+    }
+    input_obj.count--;
+    *input = input_obj.pins[input_obj.count];                                   // last entry fills the gap
+    Input_Lock(false);
+}
+
+
+bool Input_GetState( uint8_t _pin ) {
+    INPUT_PIN *input;
+
+    input = Input_Find(_pin);
+    if (!input) {
+        return Digital_ReadPin(_pin);
+    }
+    return input->state;
+}
+
+
+void Input_DebounceTick( void ) {
+    INPUT_PIN *input;
+    bool level;
+    uint8_t i;
+
+    for (i = 0; i < input_obj.count; i++) {
+        input = &input_obj.pins[i];
+        if (input->countdown == 0) {
+            continue;
+        }
+        input->countdown--;
+        if (input->countdown == 0) {                                            // pin was stable for debounce_ms
+            level = (Digital_ReadPort(input->port) & input->mask) != 0;
+            if (level != input->state) {
+                Input_Report(input, level);
+            }
+        }
+    }
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CNAInterrupt ( void ) {
+    uint16_t flags;
+
+    CPULOAD_ISR_ENTER();
+    flags = CNFA;
+    CNFA = CNFA & ~flags;                                                       // clear only the flags being handled
+    _CNAIF = false;
+    Input_Changed(PORT_A, flags);
+    CPULOAD_ISR_EXIT(CPULOAD_INPUT);
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CNBInterrupt ( void ) {
+    uint16_t flags;
+
+    CPULOAD_ISR_ENTER();
+    flags = CNFB;
+    CNFB = CNFB & ~flags;                                                       // clear only the flags being handled
+    _CNBIF = false;
+    Input_Changed(PORT_B, flags);
+    CPULOAD_ISR_EXIT(CPULOAD_INPUT);
+}
+
+
+/**
+ End of File
+*/
@@ -0,0 +1,113 @@
+/*
+ * File:            dspic33ck_input.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for change notification (CN) digital input routines
+ */
+
+
+#ifndef _DSPIC33CK_INPUT_H
+#define _DSPIC33CK_INPUT_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define INPUT_MAX_PINS                8     // max number of attached input pins
+
+#define INPUT_RISING                  0x1   // callback on low to high
+#define INPUT_FALLING                 0x2   // callback on high to low
+#define INPUT_BOTH                    0x3
+
+#define INPUT_PULL_NONE               0x0
+#define INPUT_PULL_UP                 0x1
+#define INPUT_PULL_DOWN               0x2
+
+
+typedef struct _INPUT_PIN_STRUCT {
+    uint8_t                 pin;
+    uint8_t                 port;
+    uint16_t                mask;                                               // PORTx bit
+    uint8_t                 edge;
+    uint8_t                 debounce_ms;
+    volatile uint8_t        countdown;                                          // ms left until the pin is sampled again
+    volatile bool           state;                                              // debounced pin state
+    void                    (*callback)( uint8_t _pin, bool _state );
+} INPUT_PIN;
+
+
+typedef struct _INPUT_OBJ_STRUCT {
+    INPUT_PIN               pins[INPUT_MAX_PINS];
+    volatile uint8_t        count;
+    bool                    saved_cnaie;                                        // interrupt enables before Input_Lock()
+    bool                    saved_cnbie;
+    bool                    saved_cct1ie;
+} INPUT_OBJ;
+
+
+// *****************************************************************************
+// Input Function Call Definitions
+// Edge style change notification on PORTA and PORTB
+// *****************************************************************************
+
+/**
+  @Description
+    Configures a pin as digital input and calls back on its edges
+    With _debounce_ms = 0 the callback runs in the CN interrupt.
+    Otherwise every change restarts a countdown in the SCCP1 1ms tick, the
+    pin is sampled when it expires and the callback runs from the SCCP1
+    interrupt. Debouncing needs INPUT_EN and SCCP1_EN
+
+  @Param
+    _pin = [PA0-PA4, PB0-PB15]
+    _edge = [INPUT_RISING, INPUT_FALLING, INPUT_BOTH]
+    _pull = [INPUT_PULL_NONE, INPUT_PULL_UP, INPUT_PULL_DOWN]
+    _debounce_ms = stable time before an edge is reported, 0 = no debouncing
+    _callback = called with the pin and its new state, may be NULL
+
+  @Returns
+    false if INPUT_MAX_PINS pins are already attached
+*/
+bool Input_Attach( uint8_t _pin, uint8_t _edge, uint8_t _pull, uint8_t _debounce_ms, void (*_callback)( uint8_t _pin, bool _state ) );
+
+/**
+  @Description
+    Stops change notification on a pin and removes its callback
+
+  @Param
+    _pin = [PA0-PA4, PB0-PB15]
+
+  @Returns
+    None
+*/
+void Input_Detach( uint8_t _pin );
+
+/**
+  @Description
+    Returns the debounced state of an attached pin, it follows both edges
+    whatever edges the callback is attached to
+
+  @Param
+    _pin = [PA0-PA4, PB0-PB15]
+
+  @Returns
+    HIGH or LOW
+*/
+bool Input_GetState( uint8_t _pin );
+
+/**
+  @Description
+    Runs the debounce countdowns. Called every 1ms from the SCCP1 interrupt
+    when INPUT_EN is true
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void Input_DebounceTick( void );
+
+
+#endif //_DSPIC33CK_INPUT_H
@@ -0,0 +1,370 @@
+/*
+ * File:            dspic33ck_math.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for saturating Q15/Q31 fixed-point math routines
+ */
+
+
+#ifdef __XC16__
+#include <xc.h>
+#include "dspic33ck_core.h"
+#endif
+#include "dspic33ck_math.h"
+#if MATH_BENCHMARK_EN
+#include <math.h>
+#endif
+
+
+// *****************************************************************************
+// Math Routines
+//
+// - XC16 builds use DIV.SD/DIV.UD through the __builtin_div functions and
+//   accumulator A through __builtin_mac, every other compiler builds the
+//   portable C branch which serves as the host reference
+// - sin/cos: 64 segments per quadrant, atan2: 64 segments per octant
+//
+// *****************************************************************************
+
+static const q15_t math_sine[65] = {                                            // sin(0 - 90 degrees)
+    0, 804, 1608, 2411, 3212, 4011, 4808, 5602,
+    6393, 7180, 7962, 8740, 9512, 10279, 11039, 11793,
+    12540, 13279, 14010, 14733, 15447, 16151, 16846, 17531,
+    18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595,
+    23170, 23732, 24279, 24812, 25330, 25833, 26320, 26791,
+    27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957,
+    30274, 30572, 30853, 31114, 31357, 31581, 31786, 31972,
+    32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758,
+    32767,
+};
+
+static const uint16_t math_atan[65] = {                                         // atan(0 - 1) in 65536 = 360 degree units
+    0, 163, 326, 489, 651, 813, 975, 1136,
+    1297, 1457, 1617, 1775, 1933, 2090, 2246, 2401,
+    2555, 2708, 2860, 3010, 3159, 3307, 3453, 3599,
+    3742, 3884, 4025, 4164, 4302, 4438, 4572, 4705,
+    4836, 4966, 5094, 5220, 5344, 5467, 5589, 5708,
+    5826, 5943, 6058, 6171, 6282, 6392, 6500, 6607,
+    6712, 6815, 6917, 7018, 7117, 7214, 7310, 7405,
+    7498, 7589, 7679, 7768, 7856, 7942, 8026, 8110,
+    8192,
+};
+
+
+static uint16_t Math_DivU( uint32_t _num, uint16_t _den ) {                    // quotient must fit 16 bits
+#ifdef __XC16__
+    return __builtin_divud(_num, _den);
+#else
+    return (uint16_t) (_num / _den);
+#endif
+}
+
+
+static uint16_t Math_Interpolate( uint16_t _low, uint16_t _high, uint16_t _fraction ) {    // _fraction in 1/1024
+    return _low + (uint16_t) (((uint32_t) (_high - _low) * _fraction + 512) >> 10);
+}
+
+
+void Math_Initialize( void ) {
+#ifdef __XC16__
+    CORCONbits.IF = false;                                                      // fractional multiplies
+    CORCONbits.SATA = true;                                                     // accumulator A saturates
+    CORCONbits.ACCSAT = true;                                                   // at 9.31, 8 guard bits for sums that come back in range
+    CORCONbits.SATDW = true;                                                    // SAC writes saturate
+    CORCONbits.RND = true;                                                      // conventional rounding
+#endif
+}
+
+
+q15_t Q15_Div( q15_t _num, q15_t _den ) {
+    uint16_t magnitude;
+    uint16_t divisor;
+    bool negative;
+
+    negative = (_num < 0) != (_den < 0);
+    if (_den == 0) {
+        return negative ? Q15_MIN : Q15_MAX;
+    }
+    magnitude = (_num < 0) ? (uint16_t) -_num : (uint16_t) _num;
+    divisor = (_den < 0) ? (uint16_t) -_den : (uint16_t) _den;
+    if (magnitude >= divisor) {
+        return negative ? Q15_MIN : Q15_MAX;                                    // |result| >= 1.0
+    }
+    magnitude = Math_DivU((uint32_t) magnitude << 15, divisor);
+    return negative ? -(q15_t) magnitude : (q15_t) magnitude;
+}
+
+
+int32_t Q15_Reciprocal( q15_t _x ) {
+    uint16_t divisor;
+    uint16_t high;
+    uint16_t low;
+    uint32_t result;
+
+    if (_x == 0) {
+        return 0x7FFFFFFFL;
+    }
+    divisor = (_x < 0) ? (uint16_t) -_x : (uint16_t) _x;
+    if (divisor == 1) {
+        result = 0x7FFFFFFFL;                                                   // 2^31 does not fit
+    }
+    else {
+        // 2^31 / divisor as two 16bit quotient digits, the second divide
+        // cannot overflow because the remainder is below the divisor
+        high = Math_DivU(0x8000UL, divisor);
+        low = Math_DivU((uint32_t) (0x8000U - high * divisor) << 16, divisor);
+        result = ((uint32_t) high << 16) | low;
+    }
+    return (_x < 0) ? -(int32_t) result : (int32_t) result;
+}
+
+
+uint16_t Math_Sqrt32( uint32_t _x ) {
+    uint32_t root;
+    uint32_t bit;
+
+    root = 0;
+    bit = 1UL << 30;
+    while (bit) {                                                               // 16 iterations for any input
+        if (_x >= root + bit) {
+            _x -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t) root;
+}
+
+
+q15_t Q15_Sqrt( q15_t _x ) {
+    if (_x <= 0) {
+        return 0;
+    }
+    return (q15_t) Math_Sqrt32((uint32_t) _x << 15);
+}
+
+
+q15_t Q15_Sin( uint16_t _angle ) {
+    uint16_t index;
+    uint16_t fraction;
+    uint16_t value;
+    uint16_t quarter;
+
+    quarter = _angle & (MATH_ANGLE_90 - 1);
+    if (_angle & MATH_ANGLE_90) {
+        quarter = MATH_ANGLE_90 - quarter;                                      // 2nd and 4th quadrants mirror
+    }
+    index = quarter >> 8;                                                       // 64 segments per quadrant
+    fraction = (quarter & 0xFF) << 2;
+    value = (index >= 64) ? (uint16_t) math_sine[64] : Math_Interpolate(math_sine[index], math_sine[index + 1], fraction);
+
+    return (_angle & MATH_ANGLE_180) ? -(q15_t) value : (q15_t) value;
+}
+
+
+q15_t Q15_Cos( uint16_t _angle ) {
+    return Q15_Sin(_angle + MATH_ANGLE_90);
+}
+
+
+uint16_t Q15_Atan2( q15_t _y, q15_t _x ) {
+    uint16_t ax;
+    uint16_t ay;
+    uint16_t ratio;
+    uint16_t angle;
+    uint16_t index;
+
+    if (_x == 0 && _y == 0) {
+        return 0;
+    }
+    ax = (_x < 0) ? (uint16_t) -_x : (uint16_t) _x;
+    ay = (_y < 0) ? (uint16_t) -_y : (uint16_t) _y;
+
+    if (ay <= ax) {                                                             // first octant: atan(ay / ax)
+        ratio = (ay == ax) ? 0x8000 : Math_DivU((uint32_t) ay << 15, ax);
+    }
+    else {
+        ratio = Math_DivU((uint32_t) ax << 15, ay);
+    }
+    index = ratio >> 9;                                                         // ratio in 1.15, 64 segments
+    angle = (index >= 64) ? math_atan[64] : Math_Interpolate(math_atan[index], math_atan[index + 1], (ratio & 0x1FF) << 1);
+    if (ay > ax) {
+        angle = MATH_ANGLE_90 - angle;
+    }
+    if (_x < 0) {
+        angle = MATH_ANGLE_180 - angle;
+    }
+    if (_y < 0) {
+        angle = (uint16_t) -angle;
+    }
+    return angle;
+}
+
+
+q15_t Q15_Dot( const q15_t *_a, const q15_t *_b, uint16_t _length ) {
+#ifdef __XC16__
+    register int result asm("A");
+    uint16_t i;
+
+    result = __builtin_clr();
+    for (i = 0; i < _length; i++) {
+        result = __builtin_mac(result, _a[i], _b[i], 0, 0, 0, 0, 0, 0, 0, 0);
+    }
+    return __builtin_sacr(result, 0);
+#else
+    int64_t sum;
+    uint16_t i;
+
+    sum = 0;
+    for (i = 0; i < _length; i++) {
+        sum += (int64_t) _a[i] * _b[i] * 2;                                     // fractional product, 1.31
+        if (sum > 0x7FFFFFFFFFLL) {
+            sum = 0x7FFFFFFFFFLL;                                               // SATA at 9.31
+        }
+        else if (sum < -0x8000000000LL) {
+            sum = -0x8000000000LL;
+        }
+    }
+    if (sum >= 0x7FFF8000LL) {                                                  // SACR rounds, SATDW saturates to Q15
+        return Q15_MAX;
+    }
+    if (sum < -0x80000000LL) {
+        return Q15_MIN;
+    }
+    return Q31_ToQ15((q31_t) sum);
+#endif
+}
+
+
+#if MATH_BENCHMARK_EN
+#define MATH_PI                       3.14159265358979
+
+
+static uint32_t Math_Now( void ) {
+#ifdef __XC16__
+    return SCCP9_Read();
+#else
+    return 0;
+#endif
+}
+
+
+static void Math_Record( MATH_BENCHMARK *_result, uint8_t _entry, uint32_t _cycles, uint16_t _calls, int32_t _error ) {
+    if (_error < 0) {
+        _error = -_error;
+    }
+    if (_error > _result->max_error[_entry]) {
+        _result->max_error[_entry] = (_error > 0xFFFF) ? 0xFFFF : (uint16_t) _error;
+    }
+    _result->cycles[_entry] = (uint16_t) (_cycles / _calls);
+}
+
+
+void Math_Benchmark( MATH_BENCHMARK *_result ) {
+    uint32_t overhead;
+    uint32_t cycles;
+    uint32_t start;
+    uint16_t calls;
+    uint16_t angle;
+    int32_t expected;
+    int32_t value;
+    int32_t i;
+    int32_t j;
+    q31_t a;
+    q31_t b;
+
+#ifdef __XC16__
+    if (!CCP9CON1Lbits.CCPON) {
+        SCCP9_Initialize();
+    }
+#endif
+    for (i = 0; i < MATH_BENCH_ENTRIES; i++) {
+        _result->cycles[i] = 0;
+        _result->max_error[i] = 0;
+    }
+    start = Math_Now();
+    overhead = Math_Now() - start;                                              // cost of the timestamp itself
+
+    cycles = 0;
+    calls = 0;
+    for (i = 0; i < 65536L; i += 61) {
+        angle = (uint16_t) i;
+        start = Math_Now();
+        value = Q15_Sin(angle);
+        cycles += Math_Now() - start - overhead;
+        calls++;
+        expected = (int32_t) floor(sin(angle * (2.0 * MATH_PI / 65536.0)) * 32768.0 + 0.5);
+        Math_Record(_result, MATH_BENCH_SIN, cycles, calls, value - ((expected > 32767) ? 32767 : expected));
+    }
+
+    cycles = 0;
+    calls = 0;
+    for (i = -32768L; i < 32768L; i += 1021) {
+        for (j = -32768L; j < 32768L; j += 1531) {
+            start = Math_Now();
+            angle = Q15_Atan2((q15_t) i, (q15_t) j);
+            cycles += Math_Now() - start - overhead;
+            calls++;
+            expected = (int32_t) floor(atan2((double) i, (double) j) * (65536.0 / (2.0 * MATH_PI)) + 0.5);
+            value = (int16_t) (angle - (uint16_t) expected);                    // difference modulo 360 degrees
+            Math_Record(_result, MATH_BENCH_ATAN2, cycles, calls, value);
+        }
+    }
+
+    cycles = 0;
+    calls = 0;
+    for (i = 0; i < 32768L; i += 127) {
+        start = Math_Now();
+        value = Q15_Sqrt((q15_t) i);
+        cycles += Math_Now() - start - overhead;
+        calls++;
+        expected = (int32_t) floor(sqrt((double) i * 32768.0));
+        Math_Record(_result, MATH_BENCH_SQRT, cycles, calls, value - expected);
+    }
+
+    cycles = 0;
+    calls = 0;
+    for (i = 2; i < 32768L; i += 113) {
+        start = Math_Now();
+        value = Q15_Reciprocal((q15_t) i);
+        cycles += Math_Now() - start - overhead;
+        calls++;
+        expected = (int32_t) (0x80000000UL / (uint32_t) i);
+        Math_Record(_result, MATH_BENCH_RECIPROCAL, cycles, calls, value - expected);
+    }
+
+    cycles = 0;
+    calls = 0;
+    for (i = -32767L; i < 32768L; i += 1777) {
+        for (j = 1; j < 32768L; j += 2039) {
+            start = Math_Now();
+            value = Q15_Div((q15_t) i, (q15_t) j);
+            cycles += Math_Now() - start - overhead;
+            calls++;
+            expected = (i < -j || i >= j) ? ((i < 0) ? Q15_MIN : Q15_MAX) : (int32_t) ((i * 32768L) / j);
+            Math_Record(_result, MATH_BENCH_DIV, cycles, calls, value - expected);
+        }
+    }
+
+    cycles = 0;
+    calls = 0;
+    for (i = 0; i < 64; i++) {
+        a = (q31_t) ((uint32_t) i * 0x9E3779B9UL);                              // spread over the full range
+        b = (q31_t) ((uint32_t) (i + 17) * 0x85EBCA6BUL);
+        start = Math_Now();
+        value = Q31_Mul(a, b);
+        cycles += Math_Now() - start - overhead;
+        calls++;
+        expected = (int32_t) (((int64_t) a * b) >> 31);
+        Math_Record(_result, MATH_BENCH_Q31_MUL, cycles, calls, value - expected);
+    }
+}
+#endif
+
+
+/**
+ End of File
+*/
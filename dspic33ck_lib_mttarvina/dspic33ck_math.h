@@ -0,0 +1,349 @@
+/*
+ * File:            dspic33ck_math.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for saturating Q15/Q31 fixed-point math routines
+ */
+
+
+#ifndef _DSPIC33CK_MATH_H
+#define _DSPIC33CK_MATH_H
+
+
+#ifdef __XC16__
+#include <xc.h>
+#endif
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#ifndef MATH_BENCHMARK_EN
+#define MATH_BENCHMARK_EN             false // builds Math_Benchmark(), pulls in the floating point library
+#endif
+
+#define Q15_MAX                       ((q15_t) 0x7FFF)
+#define Q15_MIN                       ((q15_t) -0x8000)
+#define Q31_MAX                       ((q31_t) 0x7FFFFFFFL)
+#define Q31_MIN                       ((q31_t) (-0x7FFFFFFFL - 1))
+#define Q15(x)                        ((q15_t) ((x) < 0.99997 ? (x) * 32768.0 + ((x) < 0 ? -0.5 : 0.5) : 32767))  // constant conversion, e.g. Q15(0.5)
+
+#define MATH_ANGLE_90                 0x4000  // angles are uint16_t, 65536 = 360 degrees
+#define MATH_ANGLE_180                0x8000
+
+#define MATH_BENCH_SIN                0x0   // Math_Benchmark() entries
+#define MATH_BENCH_ATAN2              0x1
+#define MATH_BENCH_SQRT               0x2
+#define MATH_BENCH_RECIPROCAL         0x3
+#define MATH_BENCH_DIV                0x4
+#define MATH_BENCH_Q31_MUL            0x5
+#define MATH_BENCH_ENTRIES            6
+
+
+// one instruction on the dsPIC (MUL.SS, MUL.SU), the portable forms are the host reference
+#ifdef __XC16__
+#define MATH_MULSS(a, b)              __builtin_mulss((a), (b))
+#define MATH_MULSU(a, b)              __builtin_mulsu((a), (b))
+#else
+#define MATH_MULSS(a, b)              ((int32_t) (int16_t) (a) * (int16_t) (b))
+#define MATH_MULSU(a, b)              ((int32_t) (int16_t) (a) * (uint16_t) (b))
+#endif
+
+
+typedef int16_t q15_t;                                                          // 1.15, [-1.0, 1.0)
+typedef int32_t q31_t;                                                          // 1.31, [-1.0, 1.0)
+
+
+typedef struct _MATH_BENCHMARK_STRUCT {
+    uint16_t                cycles[MATH_BENCH_ENTRIES];                         // average instruction cycles per call, 0 on the host
+    uint16_t                max_error[MATH_BENCH_ENTRIES];                      // worst error in LSB of the result
+} MATH_BENCHMARK;
+
+
+// *****************************************************************************
+// Math Function Call Definitions
+// Every result saturates instead of wrapping
+// Builds with XC16 using the MUL/DIV/DSP instructions, and with any C99
+// compiler using portable C, so the same calls can be checked on a host
+// *****************************************************************************
+
+/**
+  @Description
+    Saturates a 32bit value to Q15
+
+  @Param
+    _x = value in Q15 units
+
+  @Returns
+    [Q15_MIN - Q15_MAX]
+*/
+inline static q15_t Q15_Sat( int32_t _x ) {
+    if (_x > Q15_MAX) {
+        return Q15_MAX;
+    }
+    if (_x < Q15_MIN) {
+        return Q15_MIN;
+    }
+    return (q15_t) _x;
+}
+
+/**
+  @Description
+    Saturating Q15 addition and subtraction
+
+  @Param
+    _a, _b = Q15 operands
+
+  @Returns
+    _a + _b or _a - _b
+*/
+inline static q15_t Q15_Add( q15_t _a, q15_t _b ) {
+    return Q15_Sat((int32_t) _a + _b);
+}
+
+inline static q15_t Q15_Sub( q15_t _a, q15_t _b ) {
+    return Q15_Sat((int32_t) _a - _b);
+}
+
+/**
+  @Description
+    Rounded, saturating Q15 multiplication, -1.0 * -1.0 = Q15_MAX
+
+  @Param
+    _a, _b = Q15 operands
+
+  @Returns
+    _a * _b
+*/
+inline static q15_t Q15_Mul( q15_t _a, q15_t _b ) {
+    return Q15_Sat((MATH_MULSS(_a, _b) + 0x4000) >> 15);
+}
+
+/**
+  @Description
+    Full precision product of two Q15 values
+
+  @Param
+    _a, _b = Q15 operands
+
+  @Returns
+    _a * _b in Q31
+*/
+inline static q31_t Q15_MulQ31( q15_t _a, q15_t _b ) {
+    int32_t product;
+
+    product = MATH_MULSS(_a, _b);
+    if (product == 0x40000000L) {
+        return Q31_MAX;                                                         // -1.0 * -1.0
+    }
+    return product << 1;
+}
+
+/**
+  @Description
+    Saturating Q31 addition and subtraction
+
+  @Param
+    _a, _b = Q31 operands
+
+  @Returns
+    _a + _b or _a - _b
+*/
+inline static q31_t Q31_Add( q31_t _a, q31_t _b ) {
+    q31_t sum;
+
+    sum = (q31_t) ((uint32_t) _a + (uint32_t) _b);
+    if (((_a ^ sum) & (_b ^ sum)) < 0) {                                        // both operands differ in sign from the sum
+        return (_a < 0) ? Q31_MIN : Q31_MAX;
+    }
+    return sum;
+}
+
+inline static q31_t Q31_Sub( q31_t _a, q31_t _b ) {
+    q31_t difference;
+
+    difference = (q31_t) ((uint32_t) _a - (uint32_t) _b);
+    if (((_a ^ _b) & (_a ^ difference)) < 0) {
+        return (_a < 0) ? Q31_MIN : Q31_MAX;
+    }
+    return difference;
+}
+
+/**
+  @Description
+    Saturating multiply-accumulate, acc + a * b
+
+  @Param
+    _acc = Q31 accumulator
+    _a, _b = Q15 operands
+
+  @Returns
+    new accumulator value
+*/
+inline static q31_t Q15_Mac( q31_t _acc, q15_t _a, q15_t _b ) {
+    return Q31_Add(_acc, Q15_MulQ31(_a, _b));
+}
+
+/**
+  @Description
+    Saturating Q31 multiplication from three 16x16 partial products, the
+    low x low product is omitted and the cross products are truncated, so
+    the result is up to 6 LSB below the exact product
+
+  @Param
+    _a, _b = Q31 operands
+
+  @Returns
+    _a * _b
+*/
+inline static q31_t Q31_Mul( q31_t _a, q31_t _b ) {
+    int32_t high;
+    int32_t middle;
+
+    high = MATH_MULSS(_a >> 16, _b >> 16);
+    middle = (MATH_MULSU(_a >> 16, _b & 0xFFFF) >> 16) + (MATH_MULSU(_b >> 16, _a & 0xFFFF) >> 16);
+    high = high + middle;
+    if (high >= 0x40000000L) {
+        return Q31_MAX;
+    }
+    return high << 1;
+}
+
+/**
+  @Description
+    Rounds a Q31 value to Q15
+
+  @Param
+    _x = Q31 value
+
+  @Returns
+    Q15 value
+*/
+inline static q15_t Q31_ToQ15( q31_t _x ) {
+    if (_x >= 0x7FFF8000L) {
+        return Q15_MAX;
+    }
+    return (q15_t) ((_x + 0x8000L) >> 16);
+}
+
+/**
+  @Description
+    Sets CORCON for Q15_Dot(): fractional multiplies, accumulator A
+    super saturation at 9.31, data space write saturation, conventional
+    rounding
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void Math_Initialize( void );
+
+/**
+  @Description
+    Saturating Q15 division
+
+  @Param
+    _num = dividend
+    _den = divisor, 0 saturates to Q15_MAX or Q15_MIN
+
+  @Returns
+    _num / _den, truncated toward 0
+*/
+q15_t Q15_Div( q15_t _num, q15_t _den );
+
+/**
+  @Description
+    Reciprocal of a Q15 value with two hardware divides
+
+  @Param
+    _x = Q15 value, 0 saturates
+
+  @Returns
+    1 / _x in Q16.16
+*/
+int32_t Q15_Reciprocal( q15_t _x );
+
+/**
+  @Description
+    Integer square root, 16 fixed iterations
+
+  @Param
+    _x = any 32bit value
+
+  @Returns
+    floor(sqrt(_x))
+*/
+uint16_t Math_Sqrt32( uint32_t _x );
+
+/**
+  @Description
+    Q15 square root
+
+  @Param
+    _x = Q15 value, negative values return 0
+
+  @Returns
+    sqrt(_x) in Q15
+*/
+q15_t Q15_Sqrt( q15_t _x );
+
+/**
+  @Description
+    Sine and cosine from a quarter-wave table with linear interpolation,
+    within 3 LSB
+
+  @Param
+    _angle = [0 - 65535] which translates to 0 - 360 degrees
+
+  @Returns
+    Q15 value
+*/
+q15_t Q15_Sin( uint16_t _angle );
+
+q15_t Q15_Cos( uint16_t _angle );
+
+/**
+  @Description
+    Four quadrant arctangent from an octant table with linear interpolation,
+    within 1 unit (0.0055 degrees)
+
+  @Param
+    _y, _x = Q15 vector components, any scale
+
+  @Returns
+    angle [0 - 65535] which translates to 0 - 360 degrees, 0 for a 0 vector
+*/
+uint16_t Q15_Atan2( q15_t _y, q15_t _x );
+
+/**
+  @Description
+    Dot product on accumulator A with 40bit headroom, for FIR filters
+    Partial sums may reach +-256 before the accumulator saturates, only
+    the final sum is saturated to Q15. Needs Math_Initialize() on the dsPIC
+
+  @Param
+    _a, _b = Q15 arrays
+    _length = number of elements
+
+  @Returns
+    rounded, saturated sum of _a[i] * _b[i]
+*/
+q15_t Q15_Dot( const q15_t *_a, const q15_t *_b, uint16_t _length );
+
+/**
+  @Description
+    Sweeps the table and divide based functions against the floating point
+    library and exact 64bit references, timing each call with SCCP9
+    Needs MATH_BENCHMARK_EN
+
+  @Param
+    _result = cycles and worst error per MATH_BENCH_x entry
+
+  @Returns
+    None
+*/
+void Math_Benchmark( MATH_BENCHMARK *_result );
+
+
+#endif //_DSPIC33CK_MATH_H
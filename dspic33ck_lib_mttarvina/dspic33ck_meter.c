@@ -0,0 +1,175 @@
+/*
+ * File:            dspic33ck_meter.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for RMS, mean, extrema and power metering routines
+ */
+
+
+#ifdef __XC16__
+#include <xc.h>
+#include "dspic33ck_core.h"
+#endif
+#include "dspic33ck_meter.h"
+
+
+// *****************************************************************************
+// Meter Routines
+//
+// - squares and cross products are 16x16 MUL.SS results summed in 64 bits,
+//   so a full window of full scale samples cannot overflow
+// - the ISR only ever writes the active bank, the main loop only reads the
+//   latched one, and the banks swap only after Meter_Release()
+//
+// *****************************************************************************
+
+static METER_OBJ meter_obj;
+
+
+static void Meter_ClearBank( METER_BANK *_bank ) {
+    uint8_t i;
+
+    for (i = 0; i < METER_CHANNELS; i++) {
+        _bank->channel[i].sum = 0;
+        _bank->channel[i].sum_squares = 0;
+        _bank->channel[i].min = Q15_MAX;
+        _bank->channel[i].max = Q15_MIN;
+    }
+    for (i = 0; i < METER_PAIRS; i++) {
+        _bank->cross[i] = 0;
+    }
+    _bank->samples = 0;
+}
+
+
+static uint32_t Meter_MeanSquare( const METER_BANK *_bank, uint8_t _channel ) {
+    return (uint32_t) (_bank->channel[_channel].sum_squares / _bank->samples);  // <= 2^30
+}
+
+
+void Meter_Initialize( uint8_t _channels, uint16_t _window ) {
+    meter_obj.channels = (_channels > METER_CHANNELS) ? METER_CHANNELS : _channels;
+    meter_obj.window = (_window == 0) ? 1 : _window;
+    meter_obj.pairs = 0;
+    meter_obj.active = 0;
+    meter_obj.ready = false;
+    meter_obj.overruns = 0;
+    Meter_ClearBank(&meter_obj.bank[0]);
+    Meter_ClearBank(&meter_obj.bank[1]);
+}
+
+
+uint8_t Meter_AddPair( uint8_t _voltage, uint8_t _current ) {
+    if (meter_obj.pairs >= METER_PAIRS || _voltage >= meter_obj.channels || _current >= meter_obj.channels) {
+        return 0xFF;
+    }
+    meter_obj.voltage[meter_obj.pairs] = _voltage;
+    meter_obj.current[meter_obj.pairs] = _current;
+    return meter_obj.pairs++;
+}
+
+
+void Meter_Add( const int16_t *_samples ) {
+    METER_BANK *bank;
+    METER_ACCUMULATOR *acc;
+    int16_t sample;
+    uint8_t i;
+
+    bank = &meter_obj.bank[meter_obj.active];
+    for (i = 0; i < meter_obj.channels; i++) {
+        sample = _samples[i];
+        acc = &bank->channel[i];
+        acc->sum += sample;
+        acc->sum_squares += (uint32_t) MATH_MULSS(sample, sample);
+        if (sample < acc->min) {
+            acc->min = sample;
+        }
+        if (sample > acc->max) {
+            acc->max = sample;
+        }
+    }
+    for (i = 0; i < meter_obj.pairs; i++) {
+        bank->cross[i] += MATH_MULSS(_samples[meter_obj.voltage[i]], _samples[meter_obj.current[i]]);
+    }
+
+    bank->samples++;
+    if (bank->samples < meter_obj.window) {
+        return;
+    }
+    if (meter_obj.ready) {                                                      // last window still being read, drop this one
+        if (meter_obj.overruns < 0xFFFF) {
+            meter_obj.overruns++;
+        }
+        Meter_ClearBank(bank);
+        return;
+    }
+    meter_obj.active ^= 1;
+    Meter_ClearBank(&meter_obj.bank[meter_obj.active]);
+    meter_obj.ready = true;
+}
+
+
+bool Meter_IsReady( void ) {
+    return meter_obj.ready;
+}
+
+
+void Meter_Release( void ) {
+    meter_obj.ready = false;
+}
+
+
+uint16_t Meter_GetOverruns( void ) {
+    return meter_obj.overruns;
+}
+
+
+bool Meter_GetChannel( uint8_t _channel, METER_CHANNEL_RESULT *_result ) {
+    const METER_BANK *bank;
+    uint32_t mean_square;
+    uint32_t dc_square;
+
+    if (!meter_obj.ready || _channel >= meter_obj.channels) {
+        return false;
+    }
+    bank = &meter_obj.bank[meter_obj.active ^ 1];
+
+    _result->mean = (int16_t) (bank->channel[_channel].sum / (int32_t) bank->samples);
+    _result->min = bank->channel[_channel].min;
+    _result->max = bank->channel[_channel].max;
+    mean_square = Meter_MeanSquare(bank, _channel);
+    _result->rms = Math_Sqrt32(mean_square);
+    dc_square = (uint32_t) MATH_MULSS(_result->mean, _result->mean);
+    _result->ac_rms = (mean_square > dc_square) ? Math_Sqrt32(mean_square - dc_square) : 0;
+
+    return true;
+}
+
+
+bool Meter_GetPower( uint8_t _pair, METER_POWER_RESULT *_result ) {
+    const METER_BANK *bank;
+    int32_t power_factor;
+
+    if (!meter_obj.ready || _pair >= meter_obj.pairs) {
+        return false;
+    }
+    bank = &meter_obj.bank[meter_obj.active ^ 1];
+
+    _result->active = (int32_t) (bank->cross[_pair] / (int32_t) bank->samples);
+    _result->apparent = (uint32_t) Math_Sqrt32(Meter_MeanSquare(bank, meter_obj.voltage[_pair]))
+                        * Math_Sqrt32(Meter_MeanSquare(bank, meter_obj.current[_pair]));
+    if (_result->apparent == 0) {
+        _result->power_factor = 0;
+    }
+    else {
+        power_factor = (int32_t) (((int64_t) _result->active << 15) / (int64_t) _result->apparent);
+        _result->power_factor = Q15_Sat(power_factor);
+    }
+
+    return true;
+}
+
+
+/**
+ End of File
+*/
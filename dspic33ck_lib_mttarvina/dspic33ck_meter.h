@@ -0,0 +1,185 @@
+/*
+ * File:            dspic33ck_meter.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for RMS, mean, extrema and power metering routines
+ */
+
+
+#ifndef _DSPIC33CK_METER_H
+#define _DSPIC33CK_METER_H
+
+
+#ifdef __XC16__
+#include <xc.h>
+#endif
+#include <stdint.h>
+#include <stdbool.h>
+#include "dspic33ck_math.h"
+
+
+#define METER_CHANNELS                4     // signals sampled together, e.g. voltage and three currents
+#define METER_PAIRS                   3     // voltage x current products for power
+
+
+typedef struct _METER_ACCUMULATOR_STRUCT {
+    int32_t                 sum;
+    uint64_t                sum_squares;
+    int16_t                 min;
+    int16_t                 max;
+} METER_ACCUMULATOR;
+
+
+typedef struct _METER_BANK_STRUCT {
+    METER_ACCUMULATOR       channel[METER_CHANNELS];
+    int64_t                 cross[METER_PAIRS];                                 // sum of voltage * current
+    uint16_t                samples;
+} METER_BANK;
+
+
+typedef struct _METER_CHANNEL_RESULT_STRUCT {
+    int16_t                 mean;                                               // all results in sample units
+    uint16_t                rms;                                                // includes the mean
+    uint16_t                ac_rms;                                             // mean removed
+    int16_t                 min;
+    int16_t                 max;
+} METER_CHANNEL_RESULT;
+
+
+typedef struct _METER_POWER_RESULT_STRUCT {
+    int32_t                 active;                                             // mean of voltage * current, sample units squared
+    uint32_t                apparent;                                           // rms voltage * rms current
+    q15_t                   power_factor;                                       // active / apparent
+} METER_POWER_RESULT;
+
+
+typedef struct _METER_OBJ_STRUCT {
+    METER_BANK              bank[2];                                            // one accumulating, one latched
+    volatile uint8_t        active;                                             // bank being accumulated
+    volatile bool           ready;                                              // the other bank holds a finished window
+    volatile uint16_t       overruns;                                           // windows dropped because the last one was not released
+    uint16_t                window;
+    uint8_t                 channels;
+    uint8_t                 pairs;
+    uint8_t                 voltage[METER_PAIRS];
+    uint8_t                 current[METER_PAIRS];
+} METER_OBJ;
+
+
+// *****************************************************************************
+// Meter Function Call Definitions
+// Meter_Add() folds one sample per channel into running accumulators from
+// the sampling ISR, no samples are stored. At the end of every window the
+// accumulators are latched, Meter_GetChannel() and Meter_GetPower() then do
+// the divides and square roots from the main loop
+// *****************************************************************************
+
+/**
+  @Description
+    Clears both banks and sets the window length, removes every power pair
+
+  @Param
+    _channels = [1 - METER_CHANNELS] samples per Meter_Add() call
+    _window = samples per window [1 - 65535], e.g. a whole number of mains
+              cycles so the RMS does not ripple
+
+  @Returns
+    None
+*/
+void Meter_Initialize( uint8_t _channels, uint16_t _window );
+
+/**
+  @Description
+    Adds a voltage x current product to the accumulators
+
+  @Param
+    _voltage = channel index of the voltage
+    _current = channel index of the current
+
+  @Returns
+    pair index for Meter_GetPower(), 0xFF if METER_PAIRS are in use
+*/
+uint8_t Meter_AddPair( uint8_t _voltage, uint8_t _current );
+
+/**
+  @Description
+    Accumulates one sample per channel, about 25 instruction cycles per
+    channel and 15 per pair. Called from the ADC or sampling ISR
+
+  @Param
+    _samples = one signed sample per channel, e.g. ADC counts less the
+               zero offset, or Q15
+
+  @Returns
+    None
+*/
+void Meter_Add( const int16_t *_samples );
+
+/**
+  @Description
+    Returns true when a window is latched and not yet released
+
+  @Param
+    None.
+
+  @Returns
+    true if results are ready
+*/
+bool Meter_IsReady( void );
+
+/**
+  @Description
+    Releases the latched window so the next one can be latched, call after
+    reading every result. A window that ends before the release is dropped
+    and counted in Meter_GetOverruns()
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void Meter_Release( void );
+
+/**
+  @Description
+    Returns the number of windows dropped since Meter_Initialize()
+
+  @Param
+    None.
+
+  @Returns
+    overruns
+*/
+uint16_t Meter_GetOverruns( void );
+
+/**
+  @Description
+    Mean, RMS with and without the mean, and extrema of a channel over the
+    latched window
+
+  @Param
+    _channel = [0 - channels - 1]
+    _result = results in sample units, RMS rounded down
+
+  @Returns
+    false if no window is latched
+*/
+bool Meter_GetChannel( uint8_t _channel, METER_CHANNEL_RESULT *_result );
+
+/**
+  @Description
+    Active power, apparent power and power factor of a pair over the
+    latched window
+
+  @Param
+    _pair = Meter_AddPair() index
+    _result = results in sample units squared
+
+  @Returns
+    false if no window is latched
+*/
+bool Meter_GetPower( uint8_t _pair, METER_POWER_RESULT *_result );
+
+
+#endif //_DSPIC33CK_METER_H
@@ -98,12 +98,14 @@ void PWMA_Attach( uint8_t _pin, uint16_t _period_us ) {
 
     pwma.duty_factor = pwma.period * 0.000244;                                  // period/4096
 
+    PMD_ModuleEnable(PMD_CCP3);                                                 // power up SCCP3 before accessing its registers
+
     //    CCPI: CCP3 Capture/Compare Event
-    //    Priority: 1
-    IPC8bits.CCP3IP = 1;
+    //    Priority: PWMA_IPL
+    IPC8bits.CCP3IP = PWMA_IPL;
     //    CCTI: CCP3 Timer Event
-    //    Priority: 1
-    IPC9bits.CCT3IP = 1;
+    //    Priority: PWMA_IPL
+    IPC9bits.CCT3IP = PWMA_IPL;
         
     // CCPON disabled; MOD Dual Edge Compare, Buffered(PWM);
     // CCSEL disabled; CCPSIDL disabled; T32 16 Bit; CCPSLP disabled;
@@ -135,7 +137,8 @@ void PWMA_Attach( uint8_t _pin, uint16_t _period_us ) {
 }
 
 
-void __attribute__ ( ( interrupt, no_auto_psv ) ) _CCP3Interrupt ( void ) {
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CCP3Interrupt ( void ) {
+    CPULOAD_ISR_ENTER();
     switch (pwma.port) {
         case PORT_A:
             LATA = LATA & ~(pwma.pin);
@@ -145,10 +148,12 @@ void __attribute__ ( ( interrupt, no_auto_psv ) ) _CCP3Interrupt ( void ) {
             break;
     }
     IFS2bits.CCP3IF = 0;
+    CPULOAD_ISR_EXIT(CPULOAD_PWMA);
 }
 
 
-void __attribute__ ( ( interrupt, no_auto_psv ) ) _CCT3Interrupt ( void ) {
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CCT3Interrupt ( void ) {
+    CPULOAD_ISR_ENTER();
     if (CCP3RB > 0) {
         switch (pwma.port) {
             case PORT_A:
@@ -160,6 +165,7 @@ void __attribute__ ( ( interrupt, no_auto_psv ) ) _CCT3Interrupt ( void ) {
         }
     }
     IFS2bits.CCT3IF = 0;
+    CPULOAD_ISR_EXIT(CPULOAD_PWMA);
 }
 
 void PWMA_Start( void ) {
@@ -178,6 +184,97 @@ void PWMA_SetDuty( uint16_t _duty ) {
 }
 
 
+
+void PWMA_SetADCTrigger( uint8_t _channel, uint16_t _offset ) {
+    if (_offset < 4096) {
+        SCCP2_SyncToPWMA(pwma.period, (int) (_offset * pwma.duty_factor));
+        ADC1_Disable();
+        ADC1_SetTriggerSource(_channel, ADC1_TRIGGER_SCCP2);
+        ADC1_Enable();
+    }
+}
+
+
+// *****************************************************************************
+// PWM Generator Fault Routines - CMP1 overcurrent trip on PG1 - PG3
+//
+// - PCI source comparator 1, latched acceptance, software termination
+// - FLTDAT = 0b00 drives PWMxH and PWMxL low while the fault is active
+// - the PWM1 interrupt only counts the trip and notifies, the outputs are
+//   already safe when it runs
+//
+// *****************************************************************************
+
+static PWM_FAULT_OBJ pwm_fault;
+
+
+void PWM_FaultInitialize( uint8_t _input, uint16_t _threshold, void (*_callback)( void ) ) {
+
+    pwm_fault.count = 0;
+    pwm_fault.callback = _callback;
+
+    if (!DACCTRL1Lbits.DACON) {
+        CMP1_Initialize();
+    }
+    DAC1CONLbits.INSEL = _input;
+    DAC1CONLbits.HYSSEL = PWM_FAULT_HYSTERESIS;
+    DAC_SetValue(_threshold);
+
+    PMD_ModuleEnable(PMD_PWM);                                                  // power up the PWM before accessing its registers
+
+    PG1IOCONLbits.FLTDAT = 0x0;                                                 // PWM1H and PWM1L low while faulted
+    PG1FPCIL = PWM_PCI_SOURCE_CMP1;                                             // TSYNCDIS disabled; TERM Manual; AQSS None; PPS Not inverted; PSS Comparator 1;
+    PG1FPCIH = 0x0300;                                                          // BPEN disabled; ACP Latched; SWPCI disabled; TQSS None;
+    PG2IOCONLbits.FLTDAT = 0x0;
+    PG2FPCIL = PWM_PCI_SOURCE_CMP1;
+    PG2FPCIH = 0x0300;
+    PG3IOCONLbits.FLTDAT = 0x0;
+    PG3FPCIL = PWM_PCI_SOURCE_CMP1;
+    PG3FPCIH = 0x0300;
+
+    //    PWM1: PWM Generator 1 Event
+    //    Priority: PWMFLT_IPL
+    _PWM1IP = PWMFLT_IPL;
+    _PWM1IF = false;
+    PG1EVTHbits.FLTIEN = true;                                                  // interrupt when the PG1 fault becomes active
+    _PWM1IE = true;
+}
+
+
+bool PWM_FaultIsActive( void ) {
+    return PG1STATbits.FLTACT || PG2STATbits.FLTACT || PG3STATbits.FLTACT;
+}
+
+
+uint16_t PWM_FaultGetCount( void ) {
+    return pwm_fault.count;
+}
+
+
+bool PWM_FaultRearm( void ) {
+    if (DAC1CONLbits.CMPSTAT) {
+        return false;                                                           // latched mode would trip again right away
+    }
+    PG1FPCILbits.SWTERM = true;
+    PG2FPCILbits.SWTERM = true;
+    PG3FPCILbits.SWTERM = true;
+    return true;
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _PWM1Interrupt ( void ) {
+    CPULOAD_ISR_ENTER();
+    if (pwm_fault.count < 0xFFFF) {
+        pwm_fault.count++;
+    }
+    _PWM1IF = false;
+    if (pwm_fault.callback) {
+        pwm_fault.callback();
+    }
+    CPULOAD_ISR_EXIT(CPULOAD_PWMFLT);
+}
+
+
 /**
  End of File
 */
@@ -14,6 +14,10 @@
 #include "dspic33ck_core.h"
 
 
+#define PWM_PCI_SOURCE_CMP1           0x1B  // PGxFPCIL PSS, comparator 1 output
+#define PWM_FAULT_HYSTERESIS          0x1   // DAC1CONL HYSSEL, 0x1 = 15mV, 0x2 = 30mV, 0x3 = 45mV
+
+
 typedef struct _PWM_OBJ_STRUCT {
     volatile uint8_t        port;
     volatile uint16_t       pin;
@@ -22,6 +26,12 @@ typedef struct _PWM_OBJ_STRUCT {
 } PWM_OBJ;
 
 
+typedef struct _PWM_FAULT_OBJ_STRUCT {
+    volatile uint16_t       count;                                              // trips since PWM_FaultInitialize()
+    void                    (*callback)( void );
+} PWM_FAULT_OBJ;
+
+
 /**
   @Description
     Assigns a 16bit number for LATA/LATB corresponding to the input pin
@@ -98,6 +108,87 @@ void PWMA_Stop( void );
 */
 void PWMA_SetDuty( uint16_t _duty );
 
+/**
+  @Description
+    Triggers the conversions of an ADC channel from the PWMA timer instead
+    of software, once per PWM period at a fixed point, e.g. away from the
+    switching edges. Takes over SCCP2, call after PWMA_Attach() and
+    Analog_SetPin(), then read the channel with ADC1_IsConversionComplete()
+    and ADC1_GetConversionResult() instead of ADC1_Read()
+    SCCP2_SetSamplingPeriod() hands SCCP2 back to timer mode
+
+  @Param
+    _channel = ADC channel [AN0 - AN11]
+    _offset = [0 - 4095] of the period after the rising edge,
+              2048 = mid-period, duty / 2 = middle of the on-time
+
+  @Returns
+    None
+*/
+void PWMA_SetADCTrigger( uint8_t _channel, uint16_t _offset );
+
+
+
+// *****************************************************************************
+// PWM Generator Fault Routines - CMP1 overcurrent trip on PG1 - PG3
+// The comparator output drives the PCI fault input of every generator, the
+// outputs go to FLTDAT (all low) within the comparator and PCI propagation
+// delay, no instruction runs on the way. The fault is latched until
+// PWM_FaultRearm()
+// *****************************************************************************
+
+/**
+  @Description
+    Sets up CMP1 against the DAC threshold and latches a PCI fault on PG1 -
+    PG3 when the input rises above it. Call after the generators are set up,
+    e.g. after FOC_Initialize()
+
+  @Param
+    _input = comparator input [CMP1_INPUT_A - CMP1_INPUT_D], set the pin analog first
+    _threshold = DAC_SetValue() count [0 - 4095]
+    _callback = called from the PWM1 interrupt at PWMFLT_IPL on every trip, NULL if unused
+
+  @Returns
+    None
+*/
+void PWM_FaultInitialize( uint8_t _input, uint16_t _threshold, void (*_callback)( void ) );
+
+/**
+  @Description
+    Returns true while the outputs are held in the fault state
+
+  @Param
+    None.
+
+  @Returns
+    true if a trip is latched
+*/
+bool PWM_FaultIsActive( void );
+
+/**
+  @Description
+    Returns the number of trips since PWM_FaultInitialize()
+
+  @Param
+    None.
+
+  @Returns
+    trip count
+*/
+uint16_t PWM_FaultGetCount( void );
+
+/**
+  @Description
+    Clears a latched fault, the outputs resume at the next period start
+
+  @Param
+    None.
+
+  @Returns
+    false if the comparator is still tripped, the fault stays latched
+*/
+bool PWM_FaultRearm( void );
+
 
 #endif //_DSPIC33CK_PWM_H
 
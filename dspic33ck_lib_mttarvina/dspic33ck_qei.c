@@ -0,0 +1,195 @@
+/*
+ * File:            dspic33ck_qei.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for Quadrature Encoder Interface (QEI) routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_qei.h"
+
+
+// *****************************************************************************
+// QEI1 Routines
+//
+// - position counting, index and interval timer capture run in hardware
+// - QEI1_Update() computes the velocity at the control loop rate
+//
+// *****************************************************************************
+
+static QEI_OBJ qei1_obj;
+
+
+void QEI1_Attach( uint8_t _pinA, uint8_t _pinB, uint8_t _pinIndex, uint16_t _update_hz ) {
+
+    PMD_ModuleEnable(PMD_QEI1);                                                 // power up QEI1 before accessing its registers
+
+    _QEIA1R = PPS_SetInputPin(_pinA);                                           // map encoder A input
+    _QEIB1R = PPS_SetInputPin(_pinB);                                           // map encoder B input
+    if (_pinIndex != QEI1_NO_INDEX) {
+        _QEINDX1R = PPS_SetInputPin(_pinIndex);                                 // map encoder index input
+    }
+
+    qei1_obj.last_position = 0;
+    qei1_obj.velocity = 0;
+    qei1_obj.direction = 1;
+    qei1_obj.update_hz = _update_hz;
+    qei1_obj.index_event = false;
+
+    //    QEII: QEI1 Position Counter/Index Event
+    //    Priority: QEI1_IPL
+    _QEI1IP = QEI1_IPL;
+
+    QEI1CON = 0x0000;                                                           // QEIEN disabled; QEISIDL disabled; PIMOD Index does not affect position counter; IMV Index match when QEB=0 and QEA=0; INTDIV 1:1; CNTPOL Positive; GATEN disabled; CCM Quadrature Encoder mode;
+    QEI1IOCL = 0x4000;                                                          // QCAPEN disabled; FLTREN enabled; QFDIV 1:1; OUTFNC disabled; SWPAB disabled; HOMPOL, IDXPOL, QEBPOL, QEAPOL Non-inverted;
+    QEI1IOCH = 0x0000;                                                          // HCAPEN disabled;
+    QEI1STAT = 0x0000;                                                          // all QEI interrupts disabled;
+
+    POS1CNTH = 0x0000;                                                          // POSCNT 0;
+    POS1CNTL = 0x0000;                                                          // POSCNT 0;
+    INDX1CNTH = 0x0000;                                                         // INDXCNT 0;
+    INDX1CNTL = 0x0000;                                                         // INDXCNT 0;
+    INT1TMRH = 0x0000;                                                          // INTTMR 0;
+    INT1TMRL = 0x0000;                                                          // INTTMR 0;
+    QEI1GECH = 0xFFFF;                                                          // position counter upper limit, full 32bit range;
+    QEI1GECL = 0xFFFF;
+    QEI1LECH = 0x0000;                                                          // position counter lower limit, not used in modulo disabled mode;
+    QEI1LECL = 0x0000;
+
+    if (_pinIndex != QEI1_NO_INDEX) {
+        QEI1STATbits.IDXIRQ = false;
+        QEI1STATbits.IDXIEN = true;                                             // interrupt on every index pulse
+        _QEI1IF = false;
+        _QEI1IE = true;
+    }
+
+    QEI1_Start();
+}
+
+
+void QEI1_Start( void ) {
+    QEI1CONbits.QEIEN = true;
+}
+
+
+void QEI1_Stop( void ) {
+    QEI1CONbits.QEIEN = false;
+}
+
+
+void QEI1_SetIndexReset( bool _state ) {
+    if (_state) {
+        QEI1CONbits.PIMOD = 0x1;                                                // every index pulse resets the position counter
+    }
+    else {
+        QEI1CONbits.PIMOD = 0x0;                                                // index does not affect the position counter
+    }
+}
+
+
+int32_t QEI1_GetPosition( void ) {
+    uint16_t low;
+
+    low = POS1CNTL;                                                             // reading POS1CNTL latches the high word in POS1HLD
+    return (int32_t) (((uint32_t) POS1HLD << 16) | low);
+}
+
+
+void QEI1_SetPosition( int32_t _position ) {
+    POS1HLD = (uint16_t) ((uint32_t) _position >> 16);                          // writing POS1CNTL loads the high word from POS1HLD
+    POS1CNTL = (uint16_t) _position;
+    qei1_obj.last_position = _position;
+}
+
+
+void QEI1_Update( void ) {
+    int32_t position;
+
+    position = QEI1_GetPosition();
+    qei1_obj.velocity = (int16_t) (position - qei1_obj.last_position);
+    qei1_obj.last_position = position;
+
+    if (qei1_obj.velocity > 0) {
+        qei1_obj.direction = 1;
+    }
+    else if (qei1_obj.velocity < 0) {
+        qei1_obj.direction = -1;
+    }
+}
+
+
+int16_t QEI1_GetVelocity( void ) {
+    return qei1_obj.velocity;
+}
+
+
+uint32_t QEI1_GetInterval( void ) {
+    uint16_t high;
+    uint16_t low;
+
+    do {                                                                        // re-read if a new count was captured in between
+        high = INT1HLDH;
+        low = INT1HLDL;
+    } while (high != INT1HLDH);
+
+    return ((uint32_t) high << 16) | low;
+}
+
+
+int32_t QEI1_GetSpeed( void ) {
+    int16_t velocity;
+    uint32_t interval;
+    uint32_t elapsed;
+
+    velocity = qei1_obj.velocity;
+    if (velocity >= QEI1_LOWSPEED_COUNTS || velocity <= -QEI1_LOWSPEED_COUNTS) {
+        return (int32_t) velocity * qei1_obj.update_hz;
+    }
+
+    interval = QEI1_GetInterval();
+    elapsed = ((uint32_t) INT1TMRH << 16) | INT1TMRL;                           // time since the last count
+    if (elapsed > interval) {
+        interval = elapsed;                                                     // no count for longer than the last interval, speed is decaying
+    }
+    if (interval == 0) {
+        return 0;
+    }
+
+    return qei1_obj.direction * (int32_t) (CLOCK_InstructionFrequencyGet() / interval);
+}
+
+
+int32_t QEI1_GetIndexCount( void ) {
+    uint16_t low;
+
+    low = INDX1CNTL;                                                            // reading INDX1CNTL latches the high word in INDX1HLD
+    return (int32_t) (((uint32_t) INDX1HLD << 16) | low);
+}
+
+
+bool QEI1_IndexOccurred( void ) {
+    if (qei1_obj.index_event) {
+        qei1_obj.index_event = false;
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _QEI1Interrupt ( void ) {
+    CPULOAD_ISR_ENTER();
+    if (QEI1STATbits.IDXIRQ) {
+        qei1_obj.index_event = true;
+        QEI1STATbits.IDXIRQ = false;
+    }
+    _QEI1IF = false;
+    CPULOAD_ISR_EXIT(CPULOAD_QEI1);
+}
+
+
+/**
+ End of File
+*/
@@ -0,0 +1,189 @@
+/*
+ * File:            dspic33ck_qei.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for Quadrature Encoder Interface (QEI) routines
+ */
+
+
+#ifndef _DSPIC33CK_QEI_H
+#define _DSPIC33CK_QEI_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define QEI1_NO_INDEX                 0x00  // used in QEI1_Attach() if the encoder has no index pulse
+#define QEI1_LOWSPEED_COUNTS          4     // below this many counts per update, speed is taken from the interval timer
+
+
+typedef struct _QEI_OBJ_STRUCT {
+    volatile int32_t        last_position;
+    volatile int16_t        velocity;                                           // counts per update tick
+    volatile int8_t         direction;                                          // +1 or -1, last direction of travel
+    volatile uint16_t       update_hz;
+    volatile bool           index_event;
+} QEI_OBJ;
+
+
+// *****************************************************************************
+// QEI1 Function Call Definitions
+// Position counter = 32bit, interval timer resolution = 1 instruction cycle
+// *****************************************************************************
+
+/**
+  @Description
+    Initializes QEI1 in quadrature mode with input filter enabled
+    Maps encoder A, B and index inputs through PPS and starts the module
+
+  @Param
+    _pinA = encoder channel A [PB0-PB15]
+    _pinB = encoder channel B [PB0-PB15]
+    _pinIndex = encoder index [PB0-PB15] or QEI1_NO_INDEX
+    _update_hz = rate at which QEI1_Update() is called, used to scale velocity
+
+  @Returns
+    None
+*/
+void QEI1_Attach( uint8_t _pinA, uint8_t _pinB, uint8_t _pinIndex, uint16_t _update_hz );
+
+/**
+  @Description
+    Start QEI1 Module
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void QEI1_Start( void );
+
+/**
+  @Description
+    Stop QEI1 Module
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void QEI1_Stop( void );
+
+/**
+  @Description
+    Selects whether the index pulse resets the position counter to 0
+
+  @Param
+    _state = true: reset position on every index, false: free-running position
+
+  @Returns
+    None
+*/
+void QEI1_SetIndexReset( bool _state );
+
+/**
+  @Description
+    Returns the 32bit position counter
+
+  @Param
+    None.
+
+  @Returns
+    position in encoder counts (4 counts per encoder line)
+*/
+int32_t QEI1_GetPosition( void );
+
+/**
+  @Description
+    Sets the position counter
+
+  @Param
+    _position = new position in encoder counts
+
+  @Returns
+    None
+*/
+void QEI1_SetPosition( int32_t _position );
+
+/**
+  @Description
+    Samples the position and computes the position delta since the last call
+    Call at a fixed rate (the _update_hz given to QEI1_Attach()),
+    e.g. from the control loop interrupt. Costs two register reads and a subtract
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void QEI1_Update( void );
+
+/**
+  @Description
+    Returns the position delta measured by the last QEI1_Update()
+
+  @Param
+    None.
+
+  @Returns
+    velocity in counts per update tick
+*/
+int16_t QEI1_GetVelocity( void );
+
+/**
+  @Description
+    Returns the time between the last two encoder counts
+    captured by the QEI1 interval timer
+
+  @Param
+    None.
+
+  @Returns
+    interval in instruction cycles
+*/
+uint32_t QEI1_GetInterval( void );
+
+/**
+  @Description
+    Returns the encoder speed in counts per second
+    Uses the position delta at high speed and the interval timer
+    below QEI1_LOWSPEED_COUNTS counts per update tick
+
+  @Param
+    None.
+
+  @Returns
+    signed speed in counts per second
+*/
+int32_t QEI1_GetSpeed( void );
+
+/**
+  @Description
+    Returns the number of index pulses seen
+
+  @Param
+    None.
+
+  @Returns
+    index count
+*/
+int32_t QEI1_GetIndexCount( void );
+
+/**
+  @Description
+    Checks if an index pulse occurred since the last call
+
+  @Param
+    None.
+
+  @Returns
+    true if an index pulse occurred
+*/
+bool QEI1_IndexOccurred( void );
+
+
+#endif //_DSPIC33CK_QEI_H
@@ -0,0 +1,155 @@
+/*
+ * File:            dspic33ck_scope.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for triggered sample capture (scope) routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_scope.h"
+
+
+// *****************************************************************************
+// Scope Routines
+//
+// - samples are interleaved per channel in one circular buffer
+// - recording is a copy and a pointer wrap, the trigger is one compare
+// - after post_count samples past the trigger the buffer is frozen until re-armed
+//
+// *****************************************************************************
+
+static SCOPE_OBJ scope_obj;
+
+
+static uint16_t* Scope_Oldest( void ) {
+    if (scope_obj.recorded < scope_obj.depth) {
+        return scope_obj.buffer;                                                // not wrapped yet
+    }
+    return scope_obj.write;
+}
+
+
+void Scope_Initialize( uint8_t _channels, uint8_t _trigger_mode, uint8_t _trigger_channel, uint16_t _trigger_level, uint16_t _post_count ) {
+
+    if (_channels == 0 || _channels > SCOPE_MAX_CHANNELS) {
+        _channels = 1;
+    }
+    scope_obj.state = SCOPE_IDLE;
+    scope_obj.channels = _channels;
+    scope_obj.depth = SCOPE_BUFFER_WORDS / _channels;
+    scope_obj.end = scope_obj.buffer + (scope_obj.depth * _channels);
+    scope_obj.trigger_mode = _trigger_mode;
+    scope_obj.trigger_channel = (_trigger_channel < _channels) ? _trigger_channel : 0;
+    scope_obj.trigger_level = _trigger_level;
+    scope_obj.post_count = (_post_count < scope_obj.depth) ? _post_count : scope_obj.depth - 1;
+}
+
+
+void Scope_Arm( void ) {
+    scope_obj.state = SCOPE_IDLE;                                               // Scope_Record() ignores the buffer while it is reset
+    scope_obj.write = scope_obj.buffer;
+    scope_obj.trigger_sample = scope_obj.buffer;
+    scope_obj.recorded = 0;
+    scope_obj.forced = false;
+    scope_obj.previous = (scope_obj.trigger_mode == SCOPE_TRIGGER_RISING) ? 0xFFFF : 0x0000;  // no edge on the first sample
+    scope_obj.state = SCOPE_ARMED;
+}
+
+
+void Scope_Trigger( void ) {
+    scope_obj.forced = true;
+}
+
+
+void Scope_Record( const uint16_t *_samples ) {
+    uint16_t *slot;
+    uint16_t value;
+    bool hit;
+    uint8_t i;
+
+    if (scope_obj.state != SCOPE_ARMED && scope_obj.state != SCOPE_TRIGGERED) {
+        return;
+    }
+
+    slot = scope_obj.write;
+    for (i = 0; i < scope_obj.channels; i++) {
+        *scope_obj.write++ = _samples[i];
+    }
+    if (scope_obj.write >= scope_obj.end) {
+        scope_obj.write = scope_obj.buffer;
+    }
+    if (scope_obj.recorded < scope_obj.depth) {
+        scope_obj.recorded++;
+    }
+
+    value = _samples[scope_obj.trigger_channel];
+    if (scope_obj.state == SCOPE_ARMED) {
+        switch (scope_obj.trigger_mode) {
+            case SCOPE_TRIGGER_ABOVE:
+                hit = (value > scope_obj.trigger_level);
+                break;
+            case SCOPE_TRIGGER_BELOW:
+                hit = (value < scope_obj.trigger_level);
+                break;
+            case SCOPE_TRIGGER_RISING:
+                hit = (scope_obj.previous <= scope_obj.trigger_level) && (value > scope_obj.trigger_level);
+                break;
+            case SCOPE_TRIGGER_FALLING:
+                hit = (scope_obj.previous >= scope_obj.trigger_level) && (value < scope_obj.trigger_level);
+                break;
+            default:
+                hit = false;
+                break;
+        }
+        if (hit || scope_obj.forced) {
+            scope_obj.trigger_sample = slot;
+            scope_obj.post_left = scope_obj.post_count;
+            scope_obj.state = (scope_obj.post_left == 0) ? SCOPE_FROZEN : SCOPE_TRIGGERED;
+        }
+    }
+    else if (--scope_obj.post_left == 0) {
+        scope_obj.state = SCOPE_FROZEN;
+    }
+    scope_obj.previous = value;
+}
+
+
+uint8_t Scope_GetState( void ) {
+    return scope_obj.state;
+}
+
+
+uint16_t Scope_GetLength( void ) {
+    return scope_obj.recorded;
+}
+
+
+uint16_t Scope_GetTriggerIndex( void ) {
+    int16_t offset;
+
+    offset = (scope_obj.trigger_sample - Scope_Oldest()) / scope_obj.channels;
+    if (offset < 0) {
+        offset += scope_obj.depth;
+    }
+    return (uint16_t) offset;
+}
+
+
+uint16_t Scope_Read( uint16_t _index, uint8_t _channel ) {
+    uint16_t *slot;
+
+    if (scope_obj.state != SCOPE_FROZEN || _index >= scope_obj.recorded || _channel >= scope_obj.channels) {
+        return 0;
+    }
+    slot = Scope_Oldest() + (_index * scope_obj.channels);
+    if (slot >= scope_obj.end) {
+        slot -= scope_obj.depth * scope_obj.channels;
+    }
+    return slot[_channel];
+}
+
+
+/**
+ End of File
+*/
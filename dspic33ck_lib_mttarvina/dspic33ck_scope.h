@@ -0,0 +1,161 @@
+/*
+ * File:            dspic33ck_scope.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for triggered sample capture (scope) routines
+ */
+
+
+#ifndef _DSPIC33CK_SCOPE_H
+#define _DSPIC33CK_SCOPE_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define SCOPE_BUFFER_WORDS            1024  // shared by all channels, depth = SCOPE_BUFFER_WORDS / channels
+#define SCOPE_MAX_CHANNELS            4
+
+#define SCOPE_TRIGGER_NONE            0x0   // only Scope_Trigger() triggers
+#define SCOPE_TRIGGER_ABOVE           0x1   // sample > level
+#define SCOPE_TRIGGER_BELOW           0x2   // sample < level
+#define SCOPE_TRIGGER_RISING          0x3   // previous sample <= level < sample
+#define SCOPE_TRIGGER_FALLING         0x4   // previous sample >= level > sample
+
+#define SCOPE_IDLE                    0x0   // state
+#define SCOPE_ARMED                   0x1   // recording, waiting for the trigger
+#define SCOPE_TRIGGERED               0x2   // recording the post-trigger samples
+#define SCOPE_FROZEN                  0x3   // buffer holds the capture, ready to be read
+
+
+typedef struct _SCOPE_OBJ_STRUCT {
+    uint16_t                buffer[SCOPE_BUFFER_WORDS];
+    uint16_t                *write;                                             // next sample slot
+    uint16_t                *end;                                               // first word past the last whole sample
+    uint16_t                *trigger_sample;                                    // slot of the triggering sample
+    uint8_t                 channels;
+    uint16_t                depth;                                              // samples per channel
+    uint16_t                post_count;                                         // samples kept after the trigger
+    volatile uint16_t       post_left;
+    volatile uint16_t       recorded;                                           // saturates at depth
+    volatile uint8_t        state;
+    volatile bool           forced;                                             // set by Scope_Trigger(), taken at the next sample
+    uint8_t                 trigger_mode;
+    uint8_t                 trigger_channel;
+    uint16_t                trigger_level;
+    uint16_t                previous;                                           // last sample of the trigger channel
+} SCOPE_OBJ;
+
+
+// *****************************************************************************
+// Scope Function Call Definitions
+// Scope_Record() is called once per sample instant, e.g. from the ADC or
+// SCCP2 interrupt, with all recorded channels
+// *****************************************************************************
+
+/**
+  @Description
+    Sets up the capture buffer and trigger, leaves the scope idle
+
+  @Param
+    _channels = recorded channels per sample [1 - SCOPE_MAX_CHANNELS]
+    _trigger_mode = [SCOPE_TRIGGER_NONE, SCOPE_TRIGGER_ABOVE, SCOPE_TRIGGER_BELOW, SCOPE_TRIGGER_RISING, SCOPE_TRIGGER_FALLING]
+    _trigger_channel = index of the channel compared to the level [0 - _channels-1]
+    _trigger_level = level in ADC counts
+    _post_count = samples kept after the trigger, the rest of the depth is pre-trigger history
+
+  @Returns
+    None
+*/
+void Scope_Initialize( uint8_t _channels, uint8_t _trigger_mode, uint8_t _trigger_channel, uint16_t _trigger_level, uint16_t _post_count );
+
+/**
+  @Description
+    Clears the buffer and starts recording, waiting for the trigger
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void Scope_Arm( void );
+
+/**
+  @Description
+    Triggers an armed scope, e.g. from a fault handler
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void Scope_Trigger( void );
+
+/**
+  @Description
+    Stores one sample instant into the circular buffer
+    Does nothing unless armed or triggered
+
+  @Param
+    _samples = one value per channel
+
+  @Returns
+    None
+*/
+void Scope_Record( const uint16_t *_samples );
+
+/**
+  @Description
+    Returns the scope state
+
+  @Param
+    None.
+
+  @Returns
+    [SCOPE_IDLE, SCOPE_ARMED, SCOPE_TRIGGERED, SCOPE_FROZEN]
+*/
+uint8_t Scope_GetState( void );
+
+/**
+  @Description
+    Returns the number of valid samples in a frozen capture
+    Less than the depth if the trigger came before the buffer was full
+
+  @Param
+    None.
+
+  @Returns
+    number of samples per channel
+*/
+uint16_t Scope_GetLength( void );
+
+/**
+  @Description
+    Returns the position of the triggering sample in a frozen capture
+
+  @Param
+    None.
+
+  @Returns
+    sample index as used by Scope_Read()
+*/
+uint16_t Scope_GetTriggerIndex( void );
+
+/**
+  @Description
+    Reads one value of a frozen capture
+
+  @Param
+    _index = sample index, 0 = oldest [0 - Scope_GetLength()-1]
+    _channel = channel index [0 - _channels-1]
+
+  @Returns
+    sample value, 0 if the scope is not frozen
+*/
+uint16_t Scope_Read( uint16_t _index, uint8_t _channel );
+
+
+#endif //_DSPIC33CK_SCOPE_H
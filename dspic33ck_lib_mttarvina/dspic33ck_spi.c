@@ -0,0 +1,314 @@
+/*
+ * File:            dspic33ck_spi.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for SPI and DMA related routines
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_spi.h"
+
+
+// *****************************************************************************
+// SPI1 Routines
+//
+// - DMA0 writes SPI1BUFL on every SPI1 transmit event
+// - DMA1 reads SPI1BUFL on every SPI1 receive event
+// - DMA1 interrupt ends the transfer
+//
+// *****************************************************************************
+
+static SPI_OBJ spi1_obj;
+
+
+static void SPI1_ChipSelect( bool _state ) {
+    if (SPI1_HARDWARE_CS) {
+        return;                                                                 // SS1 is driven by the SPI module
+    }
+    switch (spi1_obj.port) {
+        case PORT_A:
+            if (_state) {
+                LATA = LATA & ~(spi1_obj.cs_pin);                               // active low
+            }
+            else {
+                LATA = LATA | spi1_obj.cs_pin;
+            }
+            break;
+        case PORT_B:
+            if (_state) {
+                LATB = LATB & ~(spi1_obj.cs_pin);                               // active low
+            }
+            else {
+                LATB = LATB | spi1_obj.cs_pin;
+            }
+            break;
+    }
+}
+
+
+bool SPI1_Attach( uint8_t _pinSCK, uint8_t _pinSDO, uint8_t _pinSDI, uint8_t _pinCS, uint16_t _clock_khz, uint8_t _mode ) {
+    uint32_t brg;
+
+    if (_clock_khz == 0) {
+        return false;
+    }
+    brg = CLOCK_PeripheralFrequencyGet() / (2000UL * _clock_khz);               // Fsck = Fp / (2 * (BRG + 1))
+    brg = (brg > 0) ? brg - 1 : 0;                                              // above Fp / 2 runs at Fp / 2
+    if (brg > SPI1_BRG_MAX) {
+        brg = SPI1_BRG_MAX;                                                     // below the slowest clock runs at the slowest clock
+    }
+
+    PMD_ModuleEnable(PMD_SPI1);                                                 // power up SPI1 and DMA before accessing their registers
+    PMD_ModuleEnable(PMD_DMA0);
+    PMD_ModuleEnable(PMD_DMA1);
+
+    spi1_obj.busy = false;
+    spi1_obj.triggered = false;
+    spi1_obj.callback = 0;
+
+    PPS_SetOutputPin(_pinSCK, PPS_OUT_SCK1);
+    PPS_SetOutputPin(_pinSDO, PPS_OUT_SDO1);
+    _SDI1R = PPS_SetInputPin(_pinSDI);
+
+    if (_pinCS <= PA4 && _pinCS >= PA0) {
+        spi1_obj.port = PORT_A;
+    }
+    else if (_pinCS <= PB15 && _pinCS >= PB0) {
+        spi1_obj.port = PORT_B;
+    }
+    spi1_obj.cs_pin = PWMx_GetPinRegister(_pinCS);
+
+    if (SPI1_HARDWARE_CS) {
+        PPS_SetOutputPin(_pinCS, PPS_OUT_SS1);
+    }
+    else {
+        Digital_SetPin(_pinCS, OUTPUT);
+        SPI1_ChipSelect(false);
+    }
+
+    // SPIEN disabled; MODE16 16bit; SMP Middle; MSTEN Master; ENHBUF disabled;
+    SPI1CON1L = 0x0420;
+    // MSSEN set below; FRMEN disabled;
+    SPI1CON1H = 0x0000;
+    SPI1CON2L = 0x0000;                                                         // WLENGTH per MODE16;
+    SPI1STATL = 0x0000;                                                         // clear overflow flags;
+    SPI1BRGL = (uint16_t) brg;
+
+    switch (_mode) {
+        case SPI_MODE0:
+            SPI1CON1Lbits.CKP = 0;
+            SPI1CON1Lbits.CKE = 1;
+            break;
+        case SPI_MODE1:
+            SPI1CON1Lbits.CKP = 0;
+            SPI1CON1Lbits.CKE = 0;
+            break;
+        case SPI_MODE2:
+            SPI1CON1Lbits.CKP = 1;
+            SPI1CON1Lbits.CKE = 1;
+            break;
+        case SPI_MODE3:
+            SPI1CON1Lbits.CKP = 1;
+            SPI1CON1Lbits.CKE = 0;
+            break;
+    }
+    SPI1CON1Hbits.MSSEN = SPI1_HARDWARE_CS;                                     // SS1 asserted by hardware during each word
+
+    SPI1IMSKL = 0x0000;
+    SPI1IMSKLbits.SPITBEN = true;                                               // transmit buffer empty event, triggers DMA0
+    SPI1IMSKLbits.SPIRBFEN = true;                                              // receive buffer full event, triggers DMA1
+    _SPI1TXIE = false;                                                          // events only go to the DMA
+    _SPI1RXIE = false;
+
+    DMACON = 0x0000;                                                            // DMAEN disabled; PRSSEL Fixed priority;
+    DMAL = 0x0000;                                                              // DMA may access the SFR and RAM space
+    DMAH = 0x7FFF;
+
+    // CHEN disabled; SIZE Word; TRMODE One-Shot; SAMODE Incremented; DAMODE Unchanged;
+    DMACH0 = 0x0000;
+    DMACH0bits.SAMODE = 0x1;
+    DMAINT0 = 0x0000;
+    DMAINT0bits.CHSEL = DMA_TRIGGER_SPI1_TX;
+    DMADST0 = (uint16_t) &SPI1BUFL;
+
+    // CHEN disabled; SIZE Word; TRMODE One-Shot; SAMODE Unchanged; DAMODE Incremented;
+    DMACH1 = 0x0000;
+    DMACH1bits.DAMODE = 0x1;
+    DMAINT1 = 0x0000;
+    DMAINT1bits.CHSEL = DMA_TRIGGER_SPI1_RX;
+    DMASRC1 = (uint16_t) &SPI1BUFL;
+
+    //    DMA1I: DMA1 Transfer Done
+    //    Priority: SPI1_IPL
+    _DMA1IP = SPI1_IPL;
+    _DMA1IF = false;
+    _DMA1IE = true;
+
+    DMACONbits.DMAEN = true;
+    SPI1CON1Lbits.SPIEN = true;
+
+    return true;
+}
+
+
+bool SPI1_Transfer( const uint16_t *_tx, uint16_t *_rx, uint16_t _count ) {
+
+    if (spi1_obj.busy || _count == 0) {
+        return false;
+    }
+    spi1_obj.busy = true;
+
+    DMASRC0 = (uint16_t) _tx;
+    DMACNT0 = _count;
+    DMADST1 = (uint16_t) _rx;
+    DMACNT1 = _count;
+    DMAINT1bits.DONEIF = false;
+
+    SPI1_ChipSelect(true);
+    DMACH1bits.CHEN = true;                                                     // arm receive channel first
+    DMACH0bits.CHEN = true;
+    DMACH0bits.CHREQ = true;                                                    // transmit buffer is already empty, push the first word
+
+    return true;
+}
+
+
+bool SPI1_IsBusy( void ) {
+    return spi1_obj.busy;
+}
+
+
+void SPI1_SetCallback( void (*_callback)( void ) ) {
+    spi1_obj.callback = _callback;
+}
+
+
+bool SPI1_StartTriggered( const uint16_t *_tx_frame, uint16_t _frame_words, uint16_t *_rx, uint16_t _frames ) {
+
+    if (spi1_obj.busy || !SPI1_HARDWARE_CS || _frame_words == 0 || _frame_words > SPI1_FIFO_WORDS || _frames == 0) {
+        return false;
+    }
+    if (SCCP2_IsSyncedToPWMA()) {                                               // SCCP2 belongs to PWMA_SetADCTrigger()
+        return false;
+    }
+    spi1_obj.busy = true;
+    spi1_obj.triggered = true;
+    spi1_obj.frame_words = _frame_words;
+    spi1_obj.total_words = _frame_words * _frames;
+
+    PMD_ModuleEnable(PMD_CCP2);                                                 // SCCP2 may be gated off if SCCP2_EN is false
+
+    // keep the SCCP2 setup so SPI1_StopTriggered() can put it back
+    spi1_obj.sccp2_con1l = CCP2CON1L;
+    spi1_obj.sccp2_con1h = CCP2CON1H;
+    spi1_obj.sccp2_ra = CCP2RA;
+    spi1_obj.sccp2_rb = CCP2RB;
+    spi1_obj.sccp2_ie = IEC1bits.CCP2IE;
+    spi1_obj.sccp2_tie = IEC1bits.CCT2IE;
+
+    // SCCP2 in dual edge compare mode: CCP2 event once per sampling period triggers DMA0
+    SCCP2_Stop();
+    IEC1bits.CCP2IE = false;                                                    // CCP2 event only goes to the DMA
+    CCP2CON1Lbits.MOD = 0x5;
+    CCP2CON1Hbits.SYNC = 0x00;                                                  // free running on CCP2PRL
+    CCP2RA = 0x0000;
+    CCP2RB = 0x0001;
+
+    // the whole frame is written per trigger, faster than SCK shifts it out,
+    // so it is queued in the enhanced buffer instead of the single SPI1BUFL
+    SPI1CON1Lbits.SPIEN = false;
+    SPI1CON1Lbits.ENHBUF = true;
+    SPI1IMSKHbits.RXMSK = 1;                                                    // receive event for every word in the FIFO, triggers DMA1
+    SPI1IMSKHbits.RXWIEN = true;
+    SPI1CON1Lbits.SPIEN = true;
+
+    DMASRC0 = (uint16_t) _tx_frame;
+    DMACNT0 = _frame_words;
+    DMAINT0bits.CHSEL = DMA_TRIGGER_SCCP2;
+    DMACH0bits.TRMODE = 0x3;                                                    // Repeated Continuous: whole frame per trigger, then reload
+    DMACH0bits.RELOAD = true;
+
+    DMADST1 = (uint16_t) _rx;
+    DMACNT1 = spi1_obj.total_words;
+    DMACH1bits.TRMODE = 0x1;                                                    // Repeated One-Shot: one word per receive event, wraps around
+    DMACH1bits.RELOAD = true;
+    DMAINT1bits.DONEIF = false;
+
+    DMACH1bits.CHEN = true;
+    DMACH0bits.CHEN = true;
+    CCP2CON1Lbits.CCPON = true;
+
+    return true;
+}
+
+
+void SPI1_StopTriggered( void ) {
+
+    if (!spi1_obj.triggered) {
+        return;
+    }
+
+    CCP2CON1Lbits.CCPON = false;
+    DMACH0bits.CHEN = false;
+    DMACH1bits.CHEN = false;
+
+    DMACH0bits.TRMODE = 0x0;
+    DMACH0bits.RELOAD = false;
+    DMAINT0bits.CHSEL = DMA_TRIGGER_SPI1_TX;
+    DMACH1bits.TRMODE = 0x0;
+    DMACH1bits.RELOAD = false;
+
+    SPI1CON1Lbits.SPIEN = false;                                                // back to the single word buffer, drops any words left in the FIFO
+    SPI1CON1Lbits.ENHBUF = false;
+    SPI1IMSKHbits.RXWIEN = false;
+    SPI1IMSKHbits.RXMSK = 0;
+    SPI1CON1Lbits.SPIEN = true;
+
+    CCP2CON1L = spi1_obj.sccp2_con1l & 0x7FFF;                                  // CCPON last, after the mode and sync are back
+    CCP2CON1H = spi1_obj.sccp2_con1h;
+    CCP2RA = spi1_obj.sccp2_ra;
+    CCP2RB = spi1_obj.sccp2_rb;
+    IFS1bits.CCP2IF = false;
+    IFS1bits.CCT2IF = false;
+    IEC1bits.CCP2IE = spi1_obj.sccp2_ie;
+    IEC1bits.CCT2IE = spi1_obj.sccp2_tie;
+    CCP2CON1Lbits.CCPON = (spi1_obj.sccp2_con1l & 0x8000) != 0;
+
+    spi1_obj.triggered = false;
+    spi1_obj.busy = false;
+}
+
+
+uint16_t SPI1_GetLatestFrame( void ) {
+    uint16_t done;
+
+    done = (spi1_obj.total_words - DMACNT1) / spi1_obj.frame_words;
+    if (done == 0) {
+        return (spi1_obj.total_words / spi1_obj.frame_words) - 1;               // buffer just wrapped around
+    }
+    return done - 1;
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _DMA1Interrupt ( void ) {
+    CPULOAD_ISR_ENTER();
+    if (DMAINT1bits.DONEIF) {
+        DMAINT1bits.DONEIF = false;
+        if (!spi1_obj.triggered) {
+            SPI1_ChipSelect(false);
+            DMACH0bits.CHEN = false;
+            spi1_obj.busy = false;
+        }
+        if (spi1_obj.callback) {
+            spi1_obj.callback();
+        }
+    }
+    _DMA1IF = false;
+    CPULOAD_ISR_EXIT(CPULOAD_SPI1);
+}
+
+
+/**
+ End of File
+*/
@@ -0,0 +1,164 @@
+/*
+ * File:            dspic33ck_spi.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for SPI and DMA related routines
+ */
+
+
+#ifndef _DSPIC33CK_SPI_H
+#define _DSPIC33CK_SPI_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define SPI1_HARDWARE_CS              true  // true: CS driven by SS1 (MSSEN) on every word, false: CS driven by software per transfer
+
+#define SPI1_BRG_MAX                  0x1FFF    // SPI1BRGL, 13 bits
+#define SPI1_FIFO_WORDS               8     // enhanced buffer depth in 16bit mode, longest triggered frame
+
+#define SPI_MODE0                     0x0   // CPOL = 0, CPHA = 0
+#define SPI_MODE1                     0x1   // CPOL = 0, CPHA = 1
+#define SPI_MODE2                     0x2   // CPOL = 1, CPHA = 0
+#define SPI_MODE3                     0x3   // CPOL = 1, CPHA = 1
+
+// DMA channel trigger sources (DMAINTx.CHSEL), see DMA Channel Trigger Sources table of the datasheet
+#define DMA_TRIGGER_SPI1_RX           0x02
+#define DMA_TRIGGER_SPI1_TX           0x03
+#define DMA_TRIGGER_SCCP2             0x0A
+
+
+typedef struct _SPI_OBJ_STRUCT {
+    volatile uint8_t        port;
+    volatile uint16_t       cs_pin;
+    volatile bool           busy;
+    volatile bool           triggered;
+    volatile uint16_t       frame_words;
+    volatile uint16_t       total_words;
+    uint16_t                sccp2_con1l;                                        // SCCP2 state before triggered mode
+    uint16_t                sccp2_con1h;
+    uint16_t                sccp2_ra;
+    uint16_t                sccp2_rb;
+    bool                    sccp2_ie;
+    bool                    sccp2_tie;
+    void                    (*callback)( void );
+} SPI_OBJ;
+
+
+// *****************************************************************************
+// SPI1 Function Call Definitions
+// 16bit master, full duplex transfers moved by DMA0 (TX) and DMA1 (RX)
+// *****************************************************************************
+
+/**
+  @Description
+    Initializes SPI1 as 16bit master and DMA0/DMA1 for full-duplex transfers
+    Maps SCK1, SDO1 and SDI1 through PPS
+    CS is mapped to SS1 if SPI1_HARDWARE_CS is true, otherwise driven as GPIO
+
+  @Param
+    _pinSCK = [PB0-PB15]
+    _pinSDO = [PB0-PB15]
+    _pinSDI = [PB0-PB15]
+    _pinCS = [PA0-PA4, PB0-PB15], must be a PORTB pin if SPI1_HARDWARE_CS is true
+    _clock_khz = SCK frequency in kHz, max = peripheral clock / 2, rates
+                 outside the divider range run at the nearest one
+    _mode = [SPI_MODE0 - SPI_MODE3]
+
+  @Returns
+    false if _clock_khz is 0, SPI1 is left untouched
+*/
+bool SPI1_Attach( uint8_t _pinSCK, uint8_t _pinSDO, uint8_t _pinSDI, uint8_t _pinCS, uint16_t _clock_khz, uint8_t _mode );
+
+/**
+  @Description
+    Starts a non-blocking full-duplex DMA transfer
+    Buffers must stay valid until the transfer completes
+
+  @Param
+    _tx = words to send
+    _rx = buffer for received words, same length as _tx
+    _count = number of 16bit words
+
+  @Returns
+    false if a transfer is still in progress
+*/
+bool SPI1_Transfer( const uint16_t *_tx, uint16_t *_rx, uint16_t _count );
+
+/**
+  @Description
+    Checks if a DMA transfer is in progress
+
+  @Param
+    None.
+
+  @Returns
+    true if busy
+*/
+bool SPI1_IsBusy( void );
+
+/**
+  @Description
+    Sets a function called from the DMA interrupt when a transfer completes
+    In triggered mode it is called every time the receive buffer wraps around
+
+  @Param
+    _callback = function to call, NULL to disable
+
+  @Returns
+    None
+*/
+void SPI1_SetCallback( void (*_callback)( void ) );
+
+/**
+  @Description
+    Starts triggered mode: SCCP2 starts a transfer of one frame every
+    sampling period without CPU involvement, received frames are written
+    to _rx as a circular buffer. Requires SPI1_HARDWARE_CS
+    Set the sampling period with SCCP2_SetSamplingPeriod() first. Each
+    trigger queues the whole frame in the SPI1 enhanced buffer, so a frame
+    holds at most SPI1_FIFO_WORDS. Not available while SCCP2 is the PWMA ADC
+    trigger, see SCCP2_IsSyncedToPWMA()
+
+  @Param
+    _tx_frame = frame sent every period, e.g. a converter command word
+    _frame_words = words per frame [1 - SPI1_FIFO_WORDS]
+    _rx = circular buffer of _frames * _frame_words words
+    _frames = number of frames in _rx
+
+  @Returns
+    false if a transfer is still in progress, the frame does not fit the
+    enhanced buffer or SCCP2 is in use as the PWMA ADC trigger
+*/
+bool SPI1_StartTriggered( const uint16_t *_tx_frame, uint16_t _frame_words, uint16_t *_rx, uint16_t _frames );
+
+/**
+  @Description
+    Stops triggered mode and restores SCCP2 to the configuration and
+    interrupt enables it had before SPI1_StartTriggered()
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void SPI1_StopTriggered( void );
+
+/**
+  @Description
+    Returns the index of the frame in the circular buffer most recently
+    completed in triggered mode
+
+  @Param
+    None.
+
+  @Returns
+    frame index
+*/
+uint16_t SPI1_GetLatestFrame( void );
+
+
+#endif //_DSPIC33CK_SPI_H
@@ -21,7 +21,9 @@ static TMR_OBJ timer1_obj;
 
 void TIMER1_Initialize (void) {
     
-    IPC0bits.T1IP = 3;                                                          // Set TIMER1 Interrupt Priority: 7
+    PMD_ModuleEnable(PMD_T1);                                                   // power up TIMER1 before accessing its registers
+    
+    IPC0bits.T1IP = TIMER1_IPL;                                                 // Set TIMER1 Interrupt Priority: TIMER1_IPL
          
     TMR1 = 0x00;                                                                // TMR 1; 
 
@@ -67,7 +69,8 @@ void TIMER1_CountReset( void ) {
 }
 
 
-void __attribute__ ( ( interrupt, no_auto_psv ) ) _T1Interrupt() {                                                      
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _T1Interrupt() {                                                      
+    CPULOAD_ISR_ENTER();
     timer1_obj.count++;
     
     if (timer1_obj.count > 0xFFFE) {
@@ -75,6 +78,7 @@ void __attribute__ ( ( interrupt, no_auto_psv ) ) _T1Interrupt() {
     }
 
     IFS0bits.T1IF = false;
+    CPULOAD_ISR_EXIT(CPULOAD_TIMER1);
 }
 
 
@@ -103,12 +107,14 @@ static SCCP1_TMR_OBJ sccp1_obj;
 
 void SCCP1_Initialize( void ) {
     
+    PMD_ModuleEnable(PMD_CCP1);                                                 // power up SCCP1 before accessing its registers
+    
     //    CCPI: CCP1 Capture/Compare Event
-    //    Priority: 2
-    IPC1bits.CCP1IP = 2;
+    //    Priority: SCCP1_IPL
+    IPC1bits.CCP1IP = SCCP1_IPL;
     //    CCTI: CCP1 Timer Event
-    //    Priority: 2
-    IPC1bits.CCT1IP = 2;
+    //    Priority: SCCP1_IPL
+    IPC1bits.CCT1IP = SCCP1_IPL;
         
     // CCPON disabled; MOD 16-Bit/32-Bit Timer;
     // CCSEL disabled; CCPSIDL disabled; T32 32 Bit;
@@ -172,7 +178,8 @@ void SCCP1_CountReset( void ) {
 }
 
 
-void __attribute__ ( ( interrupt, no_auto_psv ) ) _CCT1Interrupt ( void ) {         
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CCT1Interrupt ( void ) {         
+    CPULOAD_ISR_ENTER();
     sccp1_obj.count++;
     sccp1_obj.count_buf++;
             
@@ -180,7 +187,20 @@ void __attribute__ ( ( interrupt, no_auto_psv ) ) _CCT1Interrupt ( void ) {
         sccp1_obj.count_by_1k++;
         sccp1_obj.count_buf = 0;
     }
+    if (I2C1_EN) {
+        I2C1_TimeoutTick();
+    }
+    if (INPUT_EN) {
+        Input_DebounceTick();
+    }
+    if (CPULOAD_EN) {
+        CPULoad_Tick();
+    }
+    if (TRACE_EN) {
+        Trace_Tick();
+    }
     IFS0bits.CCT1IF = false;
+    CPULOAD_ISR_EXIT(CPULOAD_SCCP1);
 }
 
 
@@ -191,4 +211,149 @@ unsigned long long milliseconds( void ) {
 
 unsigned long long seconds( void ) {
     return sccp1_obj.count_by_1k; 
-}
\ No newline at end of file
+}
+
+
+
+
+// *****************************************************************************
+// SCCP9 Routines
+// SCCP9 resolution = 1 instruction cycle
+// - used by SYS_FastInit() to measure boot time
+// - used as a free-running cycle counter for timing measurements
+// *****************************************************************************
+
+void SCCP9_Initialize( void ) {
+
+    PMD_ModuleEnable(PMD_CCP9);                                                 // power up SCCP9 before accessing its registers
+
+    // CCPON disabled; MOD 16-Bit/32-Bit Timer;
+    // CCSEL disabled; CCPSIDL disabled; T32 32 Bit;
+    // CCPSLP disabled; TMRPS 1:1; CLKSEL FOSC/2; TMRSYNC disabled;
+    
+    CCP9CON1L = (0x20 & 0x7FFF);                                                //Disabling CCPON bit,
+    CCP9CON1H = 0x00;                                                           //RTRGEN disabled; ALTSYNC disabled; ONESHOT disabled; TRIGEN disabled; OPS Each Time Base Period Match; SYNC None; OPSSRC Timer Interrupt Event;
+    CCP9CON2L = 0x00;                                                           //ASDGM disabled; SSDG disabled; ASDG 0; PWMRSEN disabled; 
+    CCP9CON2H = 0x00;                                                           //ICGSM Level-Sensitive mode; ICSEL IC9; AUXOUT Disabled; OCAEN disabled; OENSYNC disabled; 
+    CCP9CON3H = 0x00;                                                           //OETRIG disabled; OSCNT None; POLACE disabled; PSSACE Tri-state;
+    CCP9STATL = 0x00;                                                           //ICDIS disabled; SCEVT disabled; TRSET disabled; ICOV disabled; ASEVT disabled; ICGARM disabled; TRCLR disabled; 
+    CCP9TMRL = 0x00;                                                            //TMR 0;
+    CCP9TMRH = 0x00;                                                            //TMR 0;
+    CCP9PRL = 0xFFFF;                                                           //PR 0xFFFFFFFF, free-running;
+    CCP9PRH = 0xFFFF;                                                           //PR 0xFFFFFFFF, free-running;
+
+    _CCT9IE = false;                                                            // counter only, no interrupts
+    _CCP9IE = false;
+
+    SCCP9_Start();
+}
+
+
+void SCCP9_Start( void ) {
+    CCP9CON1Lbits.CCPON = true;
+}
+
+
+void SCCP9_Stop( void ) {
+    CCP9CON1Lbits.CCPON = false;
+}
+
+
+uint32_t SCCP9_Read( void ) {
+    uint16_t high;
+    uint16_t low;
+
+    do {                                                                        // re-read if the low word rolled over in between
+        high = CCP9TMRH;
+        low = CCP9TMRL;
+    } while (high != CCP9TMRH);
+
+    return ((uint32_t) high << 16) | low;
+}
+
+
+uint32_t SCCP9_CyclesToMicroseconds( uint32_t _cycles ) {
+    return _cycles / (CLOCK_InstructionFrequencyGet() / 1000000UL);
+}
+
+
+
+// *****************************************************************************
+// Alternate Working Register Routines
+// - CCP9 and CCT9 interrupts are raised in software at IPL1 (CTXT4)
+// - CCP9 uses the alternate register set, CCT9 saves and restores W registers
+// - same body, so the difference in round trip cycles is the save/restore cost
+// *****************************************************************************
+
+static volatile uint16_t altwreg_scratch;
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ISR_CONTEXT ) ) _CCP9Interrupt ( void ) {
+    altwreg_scratch = altwreg_scratch * 3 + 1;                                  // forces working register use
+    _CCP9IF = false;
+}
+
+
+void __attribute__ ( ( interrupt, no_auto_psv ) ) _CCT9Interrupt ( void ) {
+    altwreg_scratch = altwreg_scratch * 3 + 1;                                  // forces working register use
+    _CCT9IF = false;
+}
+
+
+static uint32_t ALTWREG_RoundTrip( bool _context ) {
+    uint32_t start;
+    uint32_t cycles;
+
+    start = SCCP9_Read();
+    if (_context) {
+        _CCP9IF = true;
+    }
+    else {
+        _CCT9IF = true;
+    }
+    Nop();                                                                      // interrupt is taken here
+    Nop();
+    cycles = SCCP9_Read() - start;
+
+    return cycles;
+}
+
+
+int16_t ALTWREG_MeasureSavings( void ) {
+    uint32_t with_context;
+    uint32_t without_context;
+    uint32_t cycles;
+    uint8_t i;
+
+    if (!ALTWREG_EN || !SCCP9_EN) {
+        return 0;
+    }
+
+    //    CCP9I/CCT9I: measurement only
+    //    Priority: SCCP9_IPL
+    _CCP9IP = SCCP9_IPL;
+    _CCT9IP = SCCP9_IPL;
+    _CCP9IF = false;
+    _CCT9IF = false;
+    _CCP9IE = true;
+    _CCT9IE = true;
+
+    with_context = 0xFFFFFFFF;
+    without_context = 0xFFFFFFFF;
+    for (i = 0; i < 8; i++) {                                                   // best of 8, ignores runs hit by other interrupts
+        cycles = ALTWREG_RoundTrip(true);
+        if (cycles < with_context) {
+            with_context = cycles;
+        }
+        cycles = ALTWREG_RoundTrip(false);
+        if (cycles < without_context) {
+            without_context = cycles;
+        }
+    }
+
+    _CCP9IE = false;
+    _CCT9IE = false;
+
+    return (int16_t) (without_context - with_context);
+}
+
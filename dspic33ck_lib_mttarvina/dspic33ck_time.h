@@ -172,4 +172,85 @@ unsigned long long milliseconds( void );
 */
 unsigned long long seconds( void );     
 
+
+// *****************************************************************************
+// SCCP9 Function Call Definitions
+// SCCP9 free-running 32-bit counter, resolution = 1 instruction cycle (FOSC/2)
+// *****************************************************************************
+
+/**
+  @Description
+    Initialize SCCP9 as a free-running 32-bit counter and start it
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void SCCP9_Initialize( void );
+
+/**
+  @Description
+    This routine starts the SCCP9 counter
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void SCCP9_Start( void );
+
+/**
+  @Description
+    This routine stops the SCCP9 counter
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void SCCP9_Stop( void );
+
+/**
+  @Description
+    Returns the current SCCP9 count in instruction cycles
+    Count rolls over every 2^32 cycles (~171s at 25MIPS)
+
+  @Param
+    None.
+
+  @Returns
+    uint32_t elapsed instruction cycles
+*/
+uint32_t SCCP9_Read( void );
+
+/**
+  @Description
+    Converts SCCP9 instruction cycles to microseconds
+
+  @Param
+    _cycles = instruction cycle count
+
+  @Returns
+    uint32_t duration in us
+*/
+uint32_t SCCP9_CyclesToMicroseconds( uint32_t _cycles );
+
+/**
+  @Description
+    Measures the instruction cycles saved per interrupt by running an ISR
+    on the alternate working registers instead of saving W registers
+    Needs ALTWREG_EN and SCCP9_EN, takes over the SCCP9 interrupts briefly
+
+  @Param
+    None.
+
+  @Returns
+    cycles saved per interrupt entry and exit, 0 if not enabled
+*/
+int16_t ALTWREG_MeasureSavings( void );
+
 #endif
\ No newline at end of file
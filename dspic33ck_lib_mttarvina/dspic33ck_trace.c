@@ -0,0 +1,166 @@
+/*
+ * File:            dspic33ck_trace.c
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is the source code for binary event trace routines over UART1
+ */
+
+
+#include <xc.h>
+#include "dspic33ck_trace.h"
+
+
+// *****************************************************************************
+// Trace Routines
+//
+// - records are stored under DISI so ISRs of any level can trace
+// - a full ring drops new records, the next record that fits is preceded by
+//   a TRACE_ID_DROPPED record with the number lost
+// - UART1 runs from FOSC/2 with the fractional baud rate generator
+// - timestamps drop the low TRACE_TIMESTAMP_SHIFT bits of SCCP9 so the 16bit
+//   field wraps slowly enough for a sync record every TRACE_SYNC_MS
+//
+// *****************************************************************************
+
+static TRACE_OBJ trace_obj;
+
+
+static void Trace_Store( uint8_t _id, uint16_t _payload ) {
+    TRACE_RECORD *record;
+    uint16_t timestamp;
+    uint32_t now;
+
+    __builtin_disi(0x3FFF);
+    now = SCCP9_Read() >> TRACE_TIMESTAMP_SHIFT;                                // taken under DISI, records stay in time order
+    timestamp = now & 0xFFFF;
+    if (_id == TRACE_ID_SYNC) {
+        _payload = now >> 16;
+    }
+    if (trace_obj.dropped && trace_obj.count < TRACE_BUFFER_RECORDS - 1) {
+        record = &trace_obj.buffer[trace_obj.head];
+        record->id = TRACE_ID_DROPPED;
+        record->timestamp = timestamp;
+        record->payload = trace_obj.dropped;
+        trace_obj.head = (trace_obj.head + 1) & (TRACE_BUFFER_RECORDS - 1);
+        trace_obj.count++;
+        trace_obj.dropped = 0;
+    }
+    if (trace_obj.count >= TRACE_BUFFER_RECORDS || trace_obj.dropped) {
+        if (trace_obj.dropped < 0xFFFF) {
+            trace_obj.dropped++;
+        }
+        __builtin_disi(0);
+        return;
+    }
+    record = &trace_obj.buffer[trace_obj.head];
+    record->id = _id;
+    record->timestamp = timestamp;
+    record->payload = _payload;
+    trace_obj.head = (trace_obj.head + 1) & (TRACE_BUFFER_RECORDS - 1);
+    trace_obj.count++;
+    __builtin_disi(0);
+}
+
+
+static bool Trace_NextFrame( void ) {
+    TRACE_RECORD record;
+    uint8_t checksum;
+    uint8_t i;
+
+    if (trace_obj.count == 0) {
+        return false;
+    }
+    record = trace_obj.buffer[trace_obj.tail];                                  // only the main loop moves the tail
+    trace_obj.tail = (trace_obj.tail + 1) & (TRACE_BUFFER_RECORDS - 1);
+    __builtin_disi(0x3FFF);
+    trace_obj.count--;
+    __builtin_disi(0);
+
+    trace_obj.frame[0] = TRACE_FRAME_SYNC;
+    trace_obj.frame[1] = record.id;
+    trace_obj.frame[2] = record.timestamp & 0xFF;                               // little endian
+    trace_obj.frame[3] = record.timestamp >> 8;
+    trace_obj.frame[4] = record.payload & 0xFF;
+    trace_obj.frame[5] = record.payload >> 8;
+    checksum = 0;
+    for (i = 1; i < TRACE_FRAME_BYTES - 1; i++) {
+        checksum ^= trace_obj.frame[i];
+    }
+    trace_obj.frame[TRACE_FRAME_BYTES - 1] = checksum;
+    trace_obj.frame_index = 0;
+
+    return true;
+}
+
+
+void Trace_Initialize( uint8_t _pin, uint32_t _baud ) {
+    uint32_t brg;
+
+    if (!TRACE_EN) {
+        return;
+    }
+    if (!CCP9CON1Lbits.CCPON) {
+        SCCP9_Initialize();                                                     // timestamp source
+    }
+
+    trace_obj.head = 0;
+    trace_obj.tail = 0;
+    trace_obj.count = 0;
+    trace_obj.dropped = 0;
+    trace_obj.frame_index = TRACE_FRAME_BYTES;
+    trace_obj.sync_tick = TRACE_SYNC_MS;                                        // first tick sends a sync record
+
+    PMD_ModuleEnable(PMD_U1);                                                   // power up UART1 before accessing its registers
+
+    brg = (CLOCK_PeripheralFrequencyGet() + _baud / 2) / _baud;                 // fractional mode: baud = FOSC/2 / BRG
+    U1MODE = 0x0000;                                                            // UARTEN disabled; MOD Asynchronous 8-bit UART;
+    U1MODEH = 0x0800;                                                           // BCLKMOD fractional; BCLKSEL FOSC/2; STSEL 1 stop bit;
+    U1STA = 0x0000;
+    U1STAH = 0x0000;
+    U1BRG = brg & 0xFFFF;
+    U1BRGH = brg >> 16;
+    PPS_SetOutputPin(_pin, PPS_OUT_U1TX);
+    U1MODEbits.UTXEN = true;
+    U1MODEbits.UARTEN = true;
+
+    Trace_Tick();
+    Trace_Event(TRACE_ID_START, RCON);
+}
+
+
+void Trace_Event( uint8_t _id, uint16_t _payload ) {
+    Trace_Store(_id, _payload);
+}
+
+
+void Trace_Tasks( void ) {
+    if (!TRACE_EN) {
+        return;
+    }
+    while (!U1STAHbits.UTXBF) {
+        if (trace_obj.frame_index >= TRACE_FRAME_BYTES && !Trace_NextFrame()) {
+            return;
+        }
+        U1TXREG = trace_obj.frame[trace_obj.frame_index++];
+    }
+}
+
+
+void Trace_Tick( void ) {
+    trace_obj.sync_tick++;
+    if (trace_obj.sync_tick < TRACE_SYNC_MS) {
+        return;
+    }
+    trace_obj.sync_tick = 0;
+    Trace_Store(TRACE_ID_SYNC, 0);
+}
+
+
+uint16_t Trace_GetPending( void ) {
+    return trace_obj.count;
+}
+
+
+/**
+ End of File
+*/
@@ -0,0 +1,128 @@
+/*
+ * File:            dspic33ck_trace.h
+ * Device:          dsPIC33CK256MP202
+ * Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+ * Description:     This is a custom header file for binary event trace routines over UART1
+ */
+
+
+#ifndef _DSPIC33CK_TRACE_H
+#define _DSPIC33CK_TRACE_H
+
+
+#include <xc.h>
+#include "dspic33ck_core.h"
+
+
+#define TRACE_BUFFER_RECORDS          128   // power of 2
+#define TRACE_FRAME_BYTES             7     // 0xA5, id, timestamp L/H, payload L/H, checksum
+#define TRACE_FRAME_SYNC              0xA5
+#define TRACE_TIMESTAMP_SHIFT         5     // timestamp unit = 2^5 instruction cycles, wraps every 42ms at 50 MIPS
+#define TRACE_SYNC_MS                 20    // sync record interval, must stay below the timestamp wrap
+
+#define TRACE_ID_SYNC                 0x00  // payload = SCCP9 >> (16 + TRACE_TIMESTAMP_SHIFT) at the record timestamp
+#define TRACE_ID_DROPPED              0x01  // payload = records lost since the last one that fit
+#define TRACE_ID_START                0x02  // payload = RCON at Trace_Initialize()
+#define TRACE_ID_USER                 0x10  // first application event id, up to 0xFF
+
+#if TRACE_SYNC_MS < 1 || TRACE_SYNC_MS * 50000UL >= (65536UL << TRACE_TIMESTAMP_SHIFT)   // 50000 cycles per ms at the fastest clock
+#error "TRACE_SYNC_MS must be shorter than one timestamp wrap"
+#endif
+
+// records an event if TRACE_EN is true, usable from ISRs and tasks
+#define TRACE(id, payload)            if (TRACE_EN) { Trace_Event((id), (payload)); }
+
+
+typedef struct _TRACE_RECORD_STRUCT {
+    uint8_t                 id;
+    uint16_t                timestamp;                                          // SCCP9 >> TRACE_TIMESTAMP_SHIFT, low word
+    uint16_t                payload;
+} TRACE_RECORD;
+
+
+typedef struct _TRACE_OBJ_STRUCT {
+    TRACE_RECORD            buffer[TRACE_BUFFER_RECORDS];
+    volatile uint16_t       head;                                               // next record written
+    volatile uint16_t       tail;                                               // next record sent
+    volatile uint16_t       count;
+    volatile uint16_t       dropped;
+    uint8_t                 frame[TRACE_FRAME_BYTES];                           // record being sent
+    uint8_t                 frame_index;                                        // TRACE_FRAME_BYTES = nothing being sent
+    uint16_t                sync_tick;
+} TRACE_OBJ;
+
+
+// *****************************************************************************
+// Trace Function Call Definitions
+// Trace_Event() only stores the record, Trace_Tasks() sends it from the main
+// loop without blocking. The SCCP1 tick adds a TRACE_ID_SYNC record often
+// enough for the host to rebuild 32bit timestamps, see tools/trace_decode.py
+// *****************************************************************************
+
+/**
+  @Description
+    Starts SCCP9 if it is not running yet and sets up UART1 TX, 8N1
+    Needs TRACE_EN and SCCP1_EN
+
+  @Param
+    _pin = UART1 TX pin [PB0-PB15]
+    _baud = baud rate, e.g. 921600
+
+  @Returns
+    None
+*/
+void Trace_Initialize( uint8_t _pin, uint32_t _baud );
+
+/**
+  @Description
+    Stores one record in the ring, about 40 cycles with interrupts held off
+    by DISI, the record is dropped and counted if the ring is full
+
+  @Param
+    _id = event id [TRACE_ID_USER - 0xFF]
+    _payload = any 16bit value
+
+  @Returns
+    None
+*/
+void Trace_Event( uint8_t _id, uint16_t _payload );
+
+/**
+  @Description
+    Moves as many bytes into the UART1 TX FIFO as fit, returns immediately
+    Called from the main loop
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void Trace_Tasks( void );
+
+/**
+  @Description
+    Adds a TRACE_ID_SYNC record every TRACE_SYNC_MS, called from the SCCP1 1ms tick
+
+  @Param
+    None.
+
+  @Returns
+    None
+*/
+void Trace_Tick( void );
+
+/**
+  @Description
+    Returns the number of records waiting to be sent
+
+  @Param
+    None.
+
+  @Returns
+    records in the ring
+*/
+uint16_t Trace_GetPending( void );
+
+
+#endif //_DSPIC33CK_TRACE_H
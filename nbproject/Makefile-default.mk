@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=main.c dspic33ck_lib_mttarvina/dspic33ck_analog.c dspic33ck_lib_mttarvina/dspic33ck_core.c dspic33ck_lib_mttarvina/dspic33ck_pwm.c dspic33ck_lib_mttarvina/dspic33ck_time.c
+SOURCEFILES_QUOTED_IF_SPACED=main.c dspic33ck_lib_mttarvina/dspic33ck_afe.c dspic33ck_lib_mttarvina/dspic33ck_analog.c dspic33ck_lib_mttarvina/dspic33ck_capture.c dspic33ck_lib_mttarvina/dspic33ck_clc.c dspic33ck_lib_mttarvina/dspic33ck_core.c dspic33ck_lib_mttarvina/dspic33ck_cpuload.c dspic33ck_lib_mttarvina/dspic33ck_crc.c dspic33ck_lib_mttarvina/dspic33ck_dds.c dspic33ck_lib_mttarvina/dspic33ck_dmt.c dspic33ck_lib_mttarvina/dspic33ck_foc.c dspic33ck_lib_mttarvina/dspic33ck_i2c.c dspic33ck_lib_mttarvina/dspic33ck_input.c dspic33ck_lib_mttarvina/dspic33ck_math.c dspic33ck_lib_mttarvina/dspic33ck_meter.c dspic33ck_lib_mttarvina/dspic33ck_pwm.c dspic33ck_lib_mttarvina/dspic33ck_qei.c dspic33ck_lib_mttarvina/dspic33ck_scope.c dspic33ck_lib_mttarvina/dspic33ck_spi.c dspic33ck_lib_mttarvina/dspic33ck_time.c dspic33ck_lib_mttarvina/dspic33ck_trace.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o.d ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o
+OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o
 
 # Source Files
-SOURCEFILES=main.c dspic33ck_lib_mttarvina/dspic33ck_analog.c dspic33ck_lib_mttarvina/dspic33ck_core.c dspic33ck_lib_mttarvina/dspic33ck_pwm.c dspic33ck_lib_mttarvina/dspic33ck_time.c
+SOURCEFILES=main.c dspic33ck_lib_mttarvina/dspic33ck_afe.c dspic33ck_lib_mttarvina/dspic33ck_analog.c dspic33ck_lib_mttarvina/dspic33ck_capture.c dspic33ck_lib_mttarvina/dspic33ck_clc.c dspic33ck_lib_mttarvina/dspic33ck_core.c dspic33ck_lib_mttarvina/dspic33ck_cpuload.c dspic33ck_lib_mttarvina/dspic33ck_crc.c dspic33ck_lib_mttarvina/dspic33ck_dds.c dspic33ck_lib_mttarvina/dspic33ck_dmt.c dspic33ck_lib_mttarvina/dspic33ck_foc.c dspic33ck_lib_mttarvina/dspic33ck_i2c.c dspic33ck_lib_mttarvina/dspic33ck_input.c dspic33ck_lib_mttarvina/dspic33ck_math.c dspic33ck_lib_mttarvina/dspic33ck_meter.c dspic33ck_lib_mttarvina/dspic33ck_pwm.c dspic33ck_lib_mttarvina/dspic33ck_qei.c dspic33ck_lib_mttarvina/dspic33ck_scope.c dspic33ck_lib_mttarvina/dspic33ck_spi.c dspic33ck_lib_mttarvina/dspic33ck_time.c dspic33ck_lib_mttarvina/dspic33ck_trace.c
 
 
 
@@ -101,30 +101,126 @@ ${OBJECTDIR}/main.o: main.c  .generated_files/2b44db0551cb9e9491d8d8f2b037c1aafd
 	@${RM} ${OBJECTDIR}/main.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  main.c  -o ${OBJECTDIR}/main.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/main.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o: dspic33ck_lib_mttarvina/dspic33ck_afe.c  .generated_files/f44c127ff5e7c84daecfe7934bcd6fc17a4eb355.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_afe.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o: dspic33ck_lib_mttarvina/dspic33ck_analog.c  .generated_files/87ab99a97ad2e11d86e11672c1d51f0704e338a2.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o.d 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_analog.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o: dspic33ck_lib_mttarvina/dspic33ck_capture.c  .generated_files/e305904bebc08178ffa1426f2003941083cf093a.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_capture.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o: dspic33ck_lib_mttarvina/dspic33ck_clc.c  .generated_files/fae95eac630e390a599d9476b9c1e3278f84d0ed.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_clc.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o: dspic33ck_lib_mttarvina/dspic33ck_core.c  .generated_files/99258b3239691366c426f4739750be9511d34edd.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o.d 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_core.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o: dspic33ck_lib_mttarvina/dspic33ck_cpuload.c  .generated_files/4988d8550762f76caea7dcffb2340d2fc672f707.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_cpuload.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o: dspic33ck_lib_mttarvina/dspic33ck_crc.c  .generated_files/686bd9541a9e7f5de2d78fc73e15c0e532501866.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_crc.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o: dspic33ck_lib_mttarvina/dspic33ck_dds.c  .generated_files/a8b41f0812d7b1c0023c842a4cb6311f265703e8.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_dds.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o: dspic33ck_lib_mttarvina/dspic33ck_dmt.c  .generated_files/7c89b50674b40e836ccbc8585c4d2b328f41bfa1.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_dmt.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o: dspic33ck_lib_mttarvina/dspic33ck_foc.c  .generated_files/ef0d54eb8a0e7c227bde82c7505458050028e6b3.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_foc.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o: dspic33ck_lib_mttarvina/dspic33ck_i2c.c  .generated_files/266661fd840905707e97a20a805665892a08e81d.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_i2c.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o: dspic33ck_lib_mttarvina/dspic33ck_input.c  .generated_files/6f99165639f0a0c55c99dcd587b5dfb5f2b24a08.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_input.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o: dspic33ck_lib_mttarvina/dspic33ck_math.c  .generated_files/4a4afaac379c21ddd5fdd2e059345a5c108d05dd.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_math.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o: dspic33ck_lib_mttarvina/dspic33ck_meter.c  .generated_files/e74b51ebee07852380bc8064c89653d3bc4b1555.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_meter.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o: dspic33ck_lib_mttarvina/dspic33ck_pwm.c  .generated_files/ebd06ebbb9b213ae61783b12afdc7a8d0e503f86.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o.d 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_pwm.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o: dspic33ck_lib_mttarvina/dspic33ck_qei.c  .generated_files/0b1c4b9039a7ee06866c8cd56d18781a2579aac7.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_qei.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o: dspic33ck_lib_mttarvina/dspic33ck_scope.c  .generated_files/497d9667353d869fe2404c9ee0100e4c0f654fcd.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_scope.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o: dspic33ck_lib_mttarvina/dspic33ck_spi.c  .generated_files/9a9a7071ff56c78ffc76e649009327302413f9d9.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_spi.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o: dspic33ck_lib_mttarvina/dspic33ck_time.c  .generated_files/79396801e6cd9b636dbf24be58f7599304442c64.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o.d 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_time.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o: dspic33ck_lib_mttarvina/dspic33ck_trace.c  .generated_files/61cf877ae5a0e72c5176f1cd8f5d68ab1fac6e08.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_trace.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 else
 ${OBJECTDIR}/main.o: main.c  .generated_files/c05369c8531103dc0f9e0a2ede97a10dadb8dfb1.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}" 
@@ -132,30 +228,126 @@ ${OBJECTDIR}/main.o: main.c  .generated_files/c05369c8531103dc0f9e0a2ede97a10dad
 	@${RM} ${OBJECTDIR}/main.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  main.c  -o ${OBJECTDIR}/main.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/main.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o: dspic33ck_lib_mttarvina/dspic33ck_afe.c  .generated_files/05cab5ec0090cd5f18fe7d9ca2b44a941e222aaa.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_afe.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_afe.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o: dspic33ck_lib_mttarvina/dspic33ck_analog.c  .generated_files/554bfe9fb26826a5ef3478c63cb69c98aff33b97.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o.d 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_analog.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_analog.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o: dspic33ck_lib_mttarvina/dspic33ck_capture.c  .generated_files/88b3c64bd5bff0a9eb6fe1599adf131e4feaee3b.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_capture.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_capture.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o: dspic33ck_lib_mttarvina/dspic33ck_clc.c  .generated_files/f1fe11c63e2092207db84ee1bb7c04e2eb0a7b3e.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_clc.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_clc.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o: dspic33ck_lib_mttarvina/dspic33ck_core.c  .generated_files/bd11e5934acc2fdf6d458185ac83dd9a68e0afe7.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o.d 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_core.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_core.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o: dspic33ck_lib_mttarvina/dspic33ck_cpuload.c  .generated_files/ec39516e311a2c17d0742f6da495d0e2fc6bd196.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_cpuload.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_cpuload.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o: dspic33ck_lib_mttarvina/dspic33ck_crc.c  .generated_files/1238e4955f979435249ca40dfc4ae797ff4bf267.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_crc.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_crc.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o: dspic33ck_lib_mttarvina/dspic33ck_dds.c  .generated_files/60222086f882bf20fe9d884c1c11180f0a5fb1ea.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_dds.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dds.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o: dspic33ck_lib_mttarvina/dspic33ck_dmt.c  .generated_files/fb695791ccf95d5d949dd821e0d9848844384b80.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_dmt.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_dmt.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o: dspic33ck_lib_mttarvina/dspic33ck_foc.c  .generated_files/18653178ccaed0d94a79082fed8641fe37a04ae1.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_foc.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_foc.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o: dspic33ck_lib_mttarvina/dspic33ck_i2c.c  .generated_files/55da21d44f5ecdff6564a1a10af4db84b04896fb.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_i2c.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_i2c.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o: dspic33ck_lib_mttarvina/dspic33ck_input.c  .generated_files/8c9f7789a34e729d3e1e2877be8cd8dac279bd6d.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_input.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_input.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o: dspic33ck_lib_mttarvina/dspic33ck_math.c  .generated_files/2674be6eedd30e20a9084b0db72eb46af1e35019.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_math.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_math.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o: dspic33ck_lib_mttarvina/dspic33ck_meter.c  .generated_files/dc5b159ada0965ba18eac5f853dc33a68ec03110.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_meter.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_meter.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o: dspic33ck_lib_mttarvina/dspic33ck_pwm.c  .generated_files/f4d10632c8be9042ac8e7d90612e299c9476f137.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o.d 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_pwm.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_pwm.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o: dspic33ck_lib_mttarvina/dspic33ck_qei.c  .generated_files/26c62ed02856b429ba8fe5c7030f30de2c37d1a9.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_qei.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_qei.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o: dspic33ck_lib_mttarvina/dspic33ck_scope.c  .generated_files/6cc69bcdd6fe2fa9139dd6c721d74c52fb080ff4.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_scope.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_scope.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o: dspic33ck_lib_mttarvina/dspic33ck_spi.c  .generated_files/26ad471c80a94905cabae99c3a6fad2347a754f0.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_spi.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_spi.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o: dspic33ck_lib_mttarvina/dspic33ck_time.c  .generated_files/4a27da026b8625d83f6ef75f660d4af2e576cef5.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
 	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o.d 
 	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_time.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_time.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o: dspic33ck_lib_mttarvina/dspic33ck_trace.c  .generated_files/eb6d1e5fb23d507a94f89cc969a66e22d8c77b74.flag .generated_files/e160cb13e7b8970c0c48e563e453e0308e9d31e4.flag
+	@${MKDIR} "${OBJECTDIR}/dspic33ck_lib_mttarvina" 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o.d 
+	@${RM} ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  dspic33ck_lib_mttarvina/dspic33ck_trace.c  -o ${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/dspic33ck_lib_mttarvina/dspic33ck_trace.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 endif
 
 # ------------------------------------------------------------------------------------
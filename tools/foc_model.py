@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+File:            foc_model.py
+Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+Description:     Bit-exact host reference model of the dspic33ck_foc.c current loop
+
+Mirrors Q15_Sin(), Q15_Mac() and every FOC_x() transform with plain Python
+integers, then runs the FOC_SelfTest() vectors. The printed signature must equal
+FOC_SELFTEST_SIGNATURE and FOC_SelfTest() on the dsPIC.
+
+Usage:
+    foc_model.py              prints the signature
+    foc_model.py --dump       also prints every step: id iq vd vq duty_a duty_b duty_c
+"""
+
+import argparse
+
+Q15_MAX = 0x7FFF
+Q15_MIN = -0x8000
+Q31_MAX = 0x7FFFFFFF
+Q31_MIN = -0x80000000
+
+FOC_ONE_BY_SQRT3 = 18919
+FOC_SQRT3_BY_2 = 28378
+FOC_DUTY_HALF = 0x4000
+FOC_SELFTEST_STEPS = 512
+
+MATH_SINE = [
+    0, 804, 1608, 2411, 3212, 4011, 4808, 5602,
+    6393, 7180, 7962, 8740, 9512, 10279, 11039, 11793,
+    12540, 13279, 14010, 14733, 15447, 16151, 16846, 17531,
+    18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595,
+    23170, 23732, 24279, 24812, 25330, 25833, 26320, 26791,
+    27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957,
+    30274, 30572, 30853, 31114, 31357, 31581, 31786, 31972,
+    32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758,
+    32767,
+]
+
+
+def s16(x):
+    x &= 0xFFFF
+    return x - 0x10000 if x & 0x8000 else x
+
+
+def sat15(x):
+    return max(Q15_MIN, min(Q15_MAX, x))
+
+
+def sat31(x):
+    return max(Q31_MIN, min(Q31_MAX, x))
+
+
+def q15_sin(angle):
+    angle &= 0xFFFF
+    quarter = angle & 0x3FFF
+    if angle & 0x4000:
+        quarter = 0x4000 - quarter
+    index = quarter >> 8
+    fraction = (quarter & 0xFF) << 2
+    if index >= 64:
+        value = MATH_SINE[64]
+    else:
+        low, high = MATH_SINE[index], MATH_SINE[index + 1]
+        value = low + (((high - low) * fraction + 512) >> 10)
+    return -value if angle & 0x8000 else value
+
+
+def q15_cos(angle):
+    return q15_sin(angle + 0x4000)
+
+
+def q15_mac(acc, a, b):
+    product = a * b
+    product = Q31_MAX if product == 0x40000000 else product << 1
+    return sat31(acc + product)
+
+
+def rnd(x):
+    return sat15((x + 0x4000) >> 15)
+
+
+def clarke(a, b):
+    return a, rnd(a * FOC_ONE_BY_SQRT3 + 2 * b * FOC_ONE_BY_SQRT3)
+
+
+def park(alpha, beta, s, c):
+    return rnd(alpha * c + beta * s), rnd(beta * c - alpha * s)
+
+
+def inverse_park(d, q, s, c):
+    return rnd(d * c - q * s), rnd(d * s + q * c)
+
+
+def svpwm(alpha, beta):
+    half = alpha >> 1
+    term = (beta * FOC_SQRT3_BY_2 + 0x4000) >> 15
+    v = [alpha, term - half, -half - term]
+    mid = (max(v) + min(v)) >> 1
+    return [max(0, sat15(x - mid + FOC_DUTY_HALF)) for x in v]
+
+
+class PI:
+    def __init__(self, kp, kp_shift, ki, limit):
+        self.kp, self.kp_shift, self.ki, self.limit = kp, min(kp_shift, 15), ki, limit
+        self.integral = 0
+
+    def update(self, error):
+        limit = self.limit << 16
+        self.integral = max(-limit, min(limit, q15_mac(self.integral, self.ki, error)))
+        output = ((self.kp * error) >> (15 - self.kp_shift)) + (self.integral >> 16)
+        return max(-self.limit, min(self.limit, output))
+
+
+def selftest(dump=False):
+    d_pi = PI(19661, 0, 1638, 16384)
+    q_pi = PI(19661, 0, 1638, 16384)
+    seed = 0x1234
+    angle = 0
+    signature = 0
+
+    def fold(sig, value):
+        return (((sig << 1) | (sig >> 15)) ^ (value & 0xFFFF)) & 0xFFFF
+
+    for i in range(FOC_SELFTEST_STEPS):
+        shift = 2 if i & 0x3F else 0
+        seed = (seed * 25173 + 13849) & 0xFFFF
+        ia = s16(seed) >> shift
+        seed = (seed * 25173 + 13849) & 0xFFFF
+        ib = s16(seed) >> shift
+        id_ref = s16(i << 5)
+        iq_ref = s16(i << 6) - 16384
+        angle = (angle + 0x0139) & 0xFFFF
+
+        s, c = q15_sin(angle), q15_cos(angle)
+        alpha, beta = clarke(ia, ib)
+        i_d, i_q = park(alpha, beta, s, c)
+        v_d = d_pi.update(sat15(id_ref - i_d))
+        v_q = q_pi.update(sat15(iq_ref - i_q))
+        alpha, beta = inverse_park(v_d, v_q, s, c)
+        duty = svpwm(alpha, beta)
+
+        for value in [i_d, i_q, v_d, v_q] + duty:
+            signature = fold(signature, value)
+        if dump:
+            print('%d %d %d %d %d %d %d' % tuple([i_d, i_q, v_d, v_q] + duty))
+
+    return signature
+
+
+def main():
+    parser = argparse.ArgumentParser(description='FOC_SelfTest() reference model')
+    parser.add_argument('--dump', action='store_true', help='print every step')
+    args = parser.parse_args()
+    print('FOC_SELFTEST_SIGNATURE 0x%04X' % selftest(args.dump))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+File:            trace_decode.py
+Author:          Tarvs' Hobbytronics (mttarvina), email: mttarvina@gmail.com
+Description:     Host-side decoder for the dspic33ck_trace.c binary event stream
+
+Frame (7 bytes): 0xA5, id, timestamp L, timestamp H, payload L, payload H, checksum
+checksum = XOR of id, timestamp and payload bytes
+timestamp = SCCP9 >> TRACE_TIMESTAMP_SHIFT low word, TRACE_ID_SYNC records carry
+the bits above it in payload
+
+Usage:
+    trace_decode.py capture.bin
+    trace_decode.py /dev/ttyUSB0 --baud 921600 --names ids.txt
+
+The names file maps ids to names, one "0x10 ADC_DONE" pair per line.
+"""
+
+import argparse
+import sys
+
+FRAME_SYNC = 0xA5
+FRAME_BYTES = 7
+
+TRACE_ID_SYNC = 0x00
+TRACE_ID_DROPPED = 0x01
+TRACE_ID_START = 0x02
+
+TIMESTAMP_SHIFT = 5                                                             # TRACE_TIMESTAMP_SHIFT in dspic33ck_trace.h
+
+NAMES = {
+    TRACE_ID_SYNC: 'SYNC',
+    TRACE_ID_DROPPED: 'DROPPED',
+    TRACE_ID_START: 'START',
+}
+
+
+def load_names(path):
+    names = dict(NAMES)
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if line:
+                event_id, name = line.split(None, 1)
+                names[int(event_id, 0)] = name.strip()
+    return names
+
+
+def frames(stream):
+    """Yields (id, timestamp, payload), resynchronizing on 0xA5 after a bad checksum."""
+    buf = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            return
+        buf += chunk
+        while len(buf) >= FRAME_BYTES:
+            if buf[0] != FRAME_SYNC:
+                del buf[0]
+                continue
+            checksum = 0
+            for b in buf[1:FRAME_BYTES - 1]:
+                checksum ^= b
+            if checksum != buf[FRAME_BYTES - 1]:
+                del buf[0]
+                continue
+            yield buf[1], buf[2] | (buf[3] << 8), buf[4] | (buf[5] << 8)
+            del buf[:FRAME_BYTES]
+
+
+def timeline(records, shift=TIMESTAMP_SHIFT):
+    """Rebuilds 32bit cycle timestamps, None until the first sync record.
+
+    A dropped record means the wraps and syncs in between may be lost too,
+    so timestamps are unknown again until the next sync record.
+    """
+    high = None
+    last_low = 0
+    for event_id, low, payload in records:
+        if event_id == TRACE_ID_SYNC:
+            high = payload
+        elif event_id == TRACE_ID_DROPPED:
+            high = None
+        elif high is not None and low < last_low:
+            high = (high + 1) & 0xFFFF                                          # wrapped since the last record
+        last_low = low
+        yield (None if high is None else (((high << 16) | low) << shift) & 0xFFFFFFFF), event_id, payload
+
+
+def open_input(path, baud):
+    try:
+        import serial
+    except ImportError:
+        serial = None
+    if serial and not path.endswith('.bin') and (path.startswith('/dev/') or path.upper().startswith('COM')):
+        return serial.Serial(path, baud, timeout=None)
+    return open(path, 'rb')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a dsPIC33CK trace stream into a timeline')
+    parser.add_argument('input', help='capture file or serial port')
+    parser.add_argument('--baud', type=int, default=921600)
+    parser.add_argument('--fcy', type=float, default=25e6, help='instruction clock in Hz')
+    parser.add_argument('--shift', type=int, default=TIMESTAMP_SHIFT, help='TRACE_TIMESTAMP_SHIFT of the firmware')
+    parser.add_argument('--names', help='id to name map file')
+    parser.add_argument('--sync', action='store_true', help='also print the sync records')
+    args = parser.parse_args()
+
+    names = load_names(args.names) if args.names else NAMES
+    first = None
+    previous = None
+
+    with open_input(args.input, args.baud) as stream:
+        for cycles, event_id, payload in timeline(frames(stream), args.shift):
+            if event_id == TRACE_ID_SYNC and not args.sync:
+                continue
+            name = names.get(event_id, '0x%02X' % event_id)
+            if event_id == TRACE_ID_DROPPED:
+                print('%14s %12s  --- %u records lost ---' % ('', '', payload), file=sys.stderr)
+            if cycles is None:
+                print('%14s %12s  %-16s 0x%04X' % ('?', '', name, payload))
+                previous = None                                                 # no delta across the gap
+                continue
+            if first is None:
+                first = cycles
+            if previous is None:
+                previous = cycles
+            delta = (cycles - previous) & 0xFFFFFFFF
+            elapsed = (cycles - first) & 0xFFFFFFFF
+            previous = cycles
+            print('%14.3f %+12.3f  %-16s 0x%04X  %u' % (elapsed * 1e6 / args.fcy, delta * 1e6 / args.fcy, name, payload, payload))
+
+
+if __name__ == '__main__':
+    main()